@@ -0,0 +1,198 @@
+// © 2025 SC5K Systems
+
+#include "src/anim.h"
+#include "src/matrix_config.h"
+#include "src/clock.h"
+#include <Arduino.h>
+#include <string.h>
+
+// flash source: containers are plain const arrays, so a read is a bounded memcpy
+static size_t flashRead(void *ctx, uint32_t offset, uint8_t *dst, size_t n) {
+  memcpy(dst, (const uint8_t *)ctx + offset, n);
+  return n;
+}
+
+AnimSource animFlashSource(const uint8_t *data, uint32_t size) {
+  AnimSource s;
+  s.read = flashRead;
+  s.ctx  = (void *)data;
+  s.size = size;
+  return s;
+}
+
+// seek: restart the read window at offset
+static void seek(AnimPlayer &a, uint32_t offset) {
+  a.winBase = offset;
+  a.winLen  = 0;
+  a.winIdx  = 0;
+}
+
+// nextByte: pull one byte through the read window, refilling it from the source as needed
+static bool nextByte(AnimPlayer &a, uint8_t &b) {
+  if (a.winIdx >= a.winLen) {
+    a.winBase += a.winLen;
+    if (a.winBase >= a.src.size) return false;
+    uint32_t n = a.src.size - a.winBase;
+    if (n > ANIM_WINDOW_BYTES) n = ANIM_WINDOW_BYTES;
+    a.winLen = (uint8_t)a.src.read(a.src.ctx, a.winBase, a.win, n);
+    a.winIdx = 0;
+    if (a.winLen == 0) return false;
+  }
+  b = a.win[a.winIdx++];
+  return true;
+}
+
+static bool nextWord(AnimPlayer &a, uint16_t &v) {
+  uint8_t lo, hi;
+  if (!nextByte(a, lo) || !nextByte(a, hi)) return false;
+  v = (uint16_t)lo | ((uint16_t)hi << 8);
+  return true;
+}
+
+// fillPixels: paint n pixels of one colour starting at linear index i, split at row ends
+static void fillPixels(AnimPlayer &a, uint32_t i, uint16_t n, uint16_t col) {
+  while (n) {
+    uint16_t px = i % a.w, py = i / a.w;
+    if (py >= a.h) return;
+    uint16_t run = a.w - px;
+    if (run > n) run = n;
+    matrix.drawFastHLine(a.x + px, a.y + py, run, col);
+    i += run;
+    n -= run;
+  }
+}
+
+// decodeFrame: apply one frame's ops to the canvas; returns its duration in ms (0 on a corrupt stream)
+static uint16_t decodeFrame(AnimPlayer &a) {
+  seek(a, a.pos);
+  uint8_t type;
+  uint16_t dur, len;
+  if (!nextByte(a, type) || !nextWord(a, dur) || !nextWord(a, len)) return 0;
+  const uint32_t total = (uint32_t)a.w * a.h;
+  uint32_t i = 0, used = 0;
+  while (used < len && i < total) {
+    uint8_t op, v;
+    if (!nextByte(a, op)) return 0;
+    used++;
+    uint16_t n = (op & 0x3F) + 1;
+    switch (op >> 6) {
+      case 0:
+        i += n;
+        break;
+      case 1:
+        i += (uint32_t)n * 64;
+        break;
+      case 2:
+        if (!nextByte(a, v)) return 0;
+        used++;
+        fillPixels(a, i, n, a.palette[v]);
+        i += n;
+        break;
+      default:
+        for (uint16_t k = 0; k < n; k++, i++) {
+          if (!nextByte(a, v)) return 0;
+          used++;
+          if (i < total) matrix.drawPixel(a.x + i % a.w, a.y + i / a.w, a.palette[v]);
+        }
+        break;
+    }
+  }
+  a.pos += 5 + len;
+  a.frame++;
+  return dur ? dur : 1;
+}
+
+// animStart: parse the 12-byte header and palette, then make frame 0 due immediately
+bool animStart(AnimPlayer &a, const AnimSource &src, int16_t x, int16_t y) {
+  a.src = src;
+  a.playing = false;
+  seek(a, 0);
+  uint8_t magic[4], w, h, flags, pad;
+  uint16_t frames, colours;
+  for (uint8_t k = 0; k < 4; k++) {
+    if (!nextByte(a, magic[k])) return false;
+  }
+  if (memcmp(magic, "PMA1", 4) != 0) return false;
+  if (!nextByte(a, w) || !nextByte(a, h) || !nextWord(a, frames) ||
+      !nextWord(a, colours) || !nextByte(a, flags) || !nextByte(a, pad)) return false;
+  if (w == 0 || h == 0 || colours == 0 || colours > ANIM_MAX_COLOURS || frames == 0) return false;
+  for (uint16_t c = 0; c < colours; c++) {
+    if (!nextWord(a, a.palette[c])) return false;
+  }
+  a.x = x;
+  a.y = y;
+  a.w = w;
+  a.h = h;
+  a.flags = flags;
+  a.frameCount = frames;
+  a.paletteSize = colours;
+  a.firstFrame = 12 + 2UL * colours;
+  a.pos = a.firstFrame;
+  a.frame = 0;
+  a.due = clockMillis();
+  a.shown = a.dropped = 0;
+  a.maxLate = 0;
+  a.playing = true;
+  return true;
+}
+
+void animStop(AnimPlayer &a) {
+  a.playing = false;
+}
+
+// animUpdate: deadlines advance by each frame's own duration, so a slow frame never shifts the schedule;
+// a player left more than a loop behind is resynced to now
+bool animUpdate(AnimPlayer &a) {
+  if (!a.playing) return false;
+  unsigned long now = clockMillis();
+  if ((long)(now - a.due) < 0) return false;
+
+  uint16_t decoded = 0;
+  unsigned long late = 0;
+  while (a.playing && (long)(now - a.due) >= 0) {
+    late = now - a.due;
+    uint16_t dur = decodeFrame(a);
+    if (dur == 0) {
+      a.playing = false;
+      break;
+    }
+    decoded++;
+    a.due += dur;
+    if (a.frame >= a.frameCount) {
+      if (a.flags & ANIM_FLAG_LOOP) {
+        a.pos = a.firstFrame;
+        a.frame = 0;
+      } else {
+        a.playing = false;
+      }
+    }
+    // a whole loop decoded and still behind: restart the schedule from now instead of
+    // decoding every loop it missed
+    if (decoded >= a.frameCount && (long)(now - a.due) >= 0) {
+      a.due = now;
+      break;
+    }
+  }
+  if (decoded == 0) return false;
+  a.dropped += decoded - 1;
+  a.shown++;
+  if (late > a.maxLate) a.maxLate = late;
+  return true;
+}
+
+void animReport(const AnimPlayer &a, const char *label) {
+  Serial.print(label);
+  Serial.print(": ");
+  Serial.print(a.playing ? "playing" : "stopped");
+  Serial.print(", frame ");
+  Serial.print(a.frame);
+  Serial.print("/");
+  Serial.print(a.frameCount);
+  Serial.print(", shown ");
+  Serial.print(a.shown);
+  Serial.print(", dropped ");
+  Serial.print(a.dropped);
+  Serial.print(", max late ");
+  Serial.print(a.maxLate);
+  Serial.println(" ms");
+}
@@ -0,0 +1,299 @@
+// © 2025 SC5K Systems
+// generated by tools/anim_encode.py -- do not edit by hand
+
+#include "src/anim_assets.h"
+
+const uint8_t animClimbBurst[] = {
+  0x50, 0x4D, 0x41, 0x31, 0x20, 0x30, 0x18, 0x00, 0x0F, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x0C, 0x03, 0xE0, 0x07, 0xFF, 0x07, 0x45, 0x29,
+  0x00, 0x60, 0x0C, 0x60, 0x80, 0x61, 0x00, 0x63, 0x00, 0xF8, 0x1F, 0xF8,
+  0x20, 0xFD, 0xE0, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x3A, 0x00, 0xBF,
+  0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF,
+  0x00, 0xB0, 0x00, 0x82, 0x0E, 0x9C, 0x00, 0x82, 0x0E, 0x9C, 0x00, 0x82,
+  0x0E, 0xBF, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF,
+  0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF,
+  0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0x8B, 0x00, 0x01, 0x3C, 0x00,
+  0x0D, 0x00, 0x46, 0x11, 0xC0, 0x0B, 0x3C, 0xC0, 0x0D, 0x02, 0xC0, 0x03,
+  0x3C, 0xC0, 0x04, 0x01, 0x3C, 0x00, 0x2F, 0x00, 0x45, 0x30, 0xC0, 0x04,
+  0x00, 0xC0, 0x0B, 0x1B, 0xC0, 0x0A, 0x00, 0xC0, 0x07, 0x00, 0xC0, 0x03,
+  0x19, 0xC0, 0x0C, 0x04, 0xC0, 0x0D, 0x18, 0xC1, 0x0D, 0x09, 0x02, 0xC1,
+  0x01, 0x03, 0x38, 0xC0, 0x03, 0x01, 0xC0, 0x02, 0x01, 0xC0, 0x0D, 0x19,
+  0xC1, 0x0B, 0x04, 0x00, 0xC1, 0x0A, 0x0C, 0x01, 0x3C, 0x00, 0x5E, 0x00,
+  0x45, 0x10, 0xC0, 0x04, 0x00, 0xC0, 0x0B, 0x1A, 0xC0, 0x0A, 0x00, 0xC0,
+  0x02, 0x00, 0xC0, 0x07, 0x00, 0xC0, 0x03, 0x17, 0xC0, 0x0C, 0x00, 0xC0,
+  0x06, 0x02, 0xC0, 0x01, 0x00, 0xC0, 0x0D, 0x17, 0xC0, 0x08, 0x00, 0xC2,
+  0x06, 0x00, 0x09, 0x00, 0xC0, 0x09, 0x16, 0xC0, 0x0D, 0x00, 0xC0, 0x09,
+  0x00, 0x82, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x03, 0x18, 0xC2, 0x01,
+  0x00, 0x08, 0x1A, 0xC0, 0x01, 0x04, 0xC0, 0x09, 0x17, 0xC0, 0x03, 0x00,
+  0xC1, 0x07, 0x02, 0x00, 0xC1, 0x06, 0x08, 0x00, 0xC0, 0x0D, 0x17, 0xC0,
+  0x0B, 0x04, 0xC0, 0x0C, 0x1A, 0xC0, 0x04, 0x00, 0xC0, 0x0A, 0x01, 0x3C,
+  0x00, 0x6D, 0x00, 0x44, 0x30, 0xC0, 0x04, 0x00, 0xC0, 0x0B, 0x19, 0xC0,
+  0x0A, 0x01, 0xC0, 0x02, 0x00, 0xC0, 0x07, 0x01, 0xC0, 0x03, 0x17, 0xC0,
+  0x06, 0x04, 0xC0, 0x01, 0x15, 0xC0, 0x0C, 0x00, 0xC0, 0x08, 0x02, 0xC0,
+  0x00, 0x02, 0xC0, 0x09, 0x00, 0xC0, 0x0D, 0x17, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x18, 0xC0, 0x09, 0x01, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x01, 0xC0,
+  0x01, 0x13, 0xC0, 0x0D, 0x03, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x03, 0xC0,
+  0x03, 0x18, 0xC0, 0x00, 0x1A, 0xC0, 0x01, 0x06, 0xC0, 0x09, 0x14, 0xC0,
+  0x03, 0x01, 0xC0, 0x07, 0x04, 0xC0, 0x08, 0x01, 0xC0, 0x0D, 0x17, 0xC0,
+  0x02, 0x00, 0xC0, 0x06, 0x19, 0xC0, 0x0B, 0x06, 0xC0, 0x0C, 0x19, 0xC0,
+  0x04, 0x00, 0xC0, 0x0A, 0x01, 0x3C, 0x00, 0x79, 0x00, 0x43, 0x2F, 0xC0,
+  0x04, 0x02, 0xC0, 0x0B, 0x37, 0xC0, 0x0A, 0x02, 0xC0, 0x02, 0x00, 0xC0,
+  0x07, 0x02, 0xC0, 0x03, 0x15, 0xC0, 0x06, 0x06, 0xC0, 0x01, 0x19, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x16, 0xC1, 0x0C, 0x08, 0x02, 0xC0, 0x00, 0x02,
+  0xC0, 0x00, 0x02, 0xC1, 0x09, 0x0D, 0x14, 0xC0, 0x00, 0x04, 0xC0, 0x00,
+  0x18, 0xC0, 0x00, 0x04, 0xC0, 0x00, 0x13, 0xC0, 0x0D, 0x00, 0xC0, 0x09,
+  0x0A, 0xC0, 0x01, 0x00, 0xC0, 0x03, 0x13, 0xC0, 0x00, 0x04, 0xC0, 0x00,
+  0x19, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x16, 0xC0,
+  0x01, 0x0A, 0xC0, 0x09, 0x11, 0xC0, 0x03, 0x0C, 0xC0, 0x0D, 0x13, 0xC0,
+  0x07, 0x06, 0xC0, 0x08, 0x19, 0xC0, 0x02, 0x00, 0xC0, 0x06, 0x18, 0xC0,
+  0x0B, 0x08, 0xC0, 0x0C, 0x17, 0xC0, 0x04, 0x02, 0xC0, 0x0A, 0x01, 0x3C,
+  0x00, 0x89, 0x00, 0x43, 0x0F, 0xC0, 0x04, 0x02, 0xC0, 0x0B, 0x1A, 0xC0,
+  0x02, 0x02, 0xC0, 0x07, 0x16, 0xC0, 0x0A, 0x0A, 0xC0, 0x03, 0x13, 0xC0,
+  0x06, 0x08, 0xC0, 0x01, 0x18, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x1A, 0xC0,
+  0x00, 0x04, 0xC0, 0x00, 0x12, 0xC0, 0x0C, 0x00, 0xC0, 0x08, 0x01, 0xC0,
+  0x00, 0x06, 0xC0, 0x00, 0x01, 0xC0, 0x09, 0x00, 0xC0, 0x0D, 0x30, 0xC0,
+  0x00, 0x08, 0xC0, 0x00, 0x11, 0xC0, 0x09, 0x0E, 0xC0, 0x01, 0x0C, 0xC0,
+  0x0D, 0x12, 0xC0, 0x03, 0x10, 0xC0, 0x00, 0x06, 0xC0, 0x00, 0x17, 0xC0,
+  0x00, 0x04, 0xC0, 0x00, 0x14, 0xC0, 0x01, 0x04, 0xC0, 0x00, 0x00, 0xC0,
+  0x00, 0x04, 0xC0, 0x09, 0x0E, 0xC0, 0x03, 0x10, 0xC0, 0x0D, 0x30, 0xC0,
+  0x07, 0x08, 0xC0, 0x08, 0x13, 0xC0, 0x0B, 0x02, 0xC0, 0x02, 0x02, 0xC0,
+  0x06, 0x02, 0xC0, 0x0C, 0x36, 0xC0, 0x04, 0x02, 0xC0, 0x0A, 0x40, 0x3D,
+  0x82, 0x0E, 0x1C, 0x82, 0x0E, 0x1C, 0x82, 0x0E, 0x01, 0x3C, 0x00, 0x7A,
+  0x00, 0x43, 0x0F, 0xC0, 0x02, 0x02, 0xC0, 0x07, 0x35, 0xC1, 0x0A, 0x06,
+  0x0A, 0xC1, 0x01, 0x03, 0x16, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x19, 0xC0,
+  0x00, 0x06, 0xC0, 0x00, 0x30, 0xC1, 0x0C, 0x08, 0x01, 0xC0, 0x00, 0x0A,
+  0xC0, 0x00, 0x01, 0xC1, 0x09, 0x0D, 0x40, 0x0E, 0xC0, 0x00, 0x0A, 0xC0,
+  0x00, 0x0D, 0xC1, 0x0D, 0x09, 0x12, 0xC1, 0x01, 0x03, 0x2D, 0xC0, 0x00,
+  0x0A, 0xC0, 0x00, 0x2F, 0xC0, 0x01, 0x03, 0xC0, 0x00, 0x06, 0xC0, 0x00,
+  0x03, 0xC0, 0x09, 0x0B, 0xC0, 0x03, 0x07, 0xC0, 0x00, 0x00, 0xC0, 0x00,
+  0x07, 0xC0, 0x0D, 0x2E, 0xC0, 0x07, 0x0A, 0xC0, 0x08, 0x31, 0xC0, 0x0B,
+  0x03, 0xC0, 0x02, 0x02, 0xC0, 0x06, 0x03, 0xC0, 0x0C, 0x35, 0xC0, 0x04,
+  0x02, 0xC0, 0x0A, 0x1E, 0xC0, 0x0D, 0x3C, 0xC0, 0x0A, 0x02, 0xC0, 0x0C,
+  0x3C, 0xC0, 0x03, 0x01, 0x3C, 0x00, 0xA2, 0x00, 0x42, 0x2E, 0xC0, 0x04,
+  0x04, 0xC0, 0x0B, 0x33, 0xC0, 0x0A, 0x04, 0xC0, 0x00, 0x02, 0xC0, 0x00,
+  0x04, 0xC0, 0x03, 0x0F, 0xC0, 0x06, 0x0C, 0xC0, 0x01, 0x12, 0xC0, 0x00,
+  0x08, 0xC0, 0x00, 0x40, 0x0D, 0xC0, 0x0C, 0x00, 0xC0, 0x08, 0x01, 0xC0,
+  0x00, 0x0C, 0xC0, 0x00, 0x01, 0xC0, 0x09, 0x00, 0xC0, 0x0D, 0x40, 0x0A,
+  0xC0, 0x00, 0x0E, 0xC0, 0x00, 0x0B, 0xC0, 0x09, 0x14, 0xC0, 0x01, 0x06,
+  0xC0, 0x0D, 0x18, 0xC0, 0x03, 0x2A, 0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x2D,
+  0xC0, 0x01, 0x12, 0xC0, 0x09, 0x0F, 0xC0, 0x00, 0x08, 0xC0, 0x00, 0x0D,
+  0xC0, 0x03, 0x08, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x08, 0xC0, 0x0D, 0x2B,
+  0xC0, 0x07, 0x0C, 0xC0, 0x08, 0x2F, 0xC0, 0x0B, 0x04, 0xC0, 0x02, 0x01,
+  0xC2, 0x03, 0x06, 0x0D, 0x03, 0xC0, 0x0C, 0x16, 0xC0, 0x0B, 0x00, 0xC0,
+  0x09, 0x00, 0xC0, 0x0C, 0x19, 0xC0, 0x04, 0x04, 0xC0, 0x0A, 0x16, 0xC0,
+  0x04, 0x00, 0xC1, 0x0A, 0x06, 0x02, 0xC1, 0x08, 0x0C, 0x38, 0xC0, 0x0C,
+  0x01, 0xC0, 0x01, 0x01, 0xC0, 0x0A, 0x19, 0xC1, 0x0D, 0x03, 0x00, 0xC1,
+  0x0B, 0x04, 0x01, 0x3C, 0x00, 0xCB, 0x00, 0x42, 0x0E, 0xC0, 0x02, 0x04,
+  0xC0, 0x07, 0x18, 0xC0, 0x02, 0x04, 0xC0, 0x07, 0x32, 0xC1, 0x06, 0x06,
+  0x0E, 0xC1, 0x01, 0x01, 0x0F, 0xC0, 0x00, 0x0A, 0xC0, 0x00, 0x40, 0x2B,
+  0xC1, 0x08, 0x08, 0x01, 0xC0, 0x00, 0x10, 0xC0, 0x00, 0x01, 0xC1, 0x09,
+  0x09, 0x40, 0x27, 0xC0, 0x00, 0x12, 0xC0, 0x00, 0x07, 0xC0, 0x09, 0x18,
+  0xC0, 0x01, 0x03, 0xC0, 0x09, 0x40, 0x03, 0xC0, 0x00, 0x10, 0xC0, 0x00,
+  0x40, 0x09, 0xC0, 0x01, 0x04, 0xC0, 0x00, 0x0A, 0xC0, 0x00, 0x04, 0xC0,
+  0x09, 0x05, 0xC0, 0x01, 0x18, 0xC0, 0x09, 0x0F, 0xC0, 0x00, 0x02, 0xC0,
+  0x00, 0x1D, 0xC0, 0x03, 0x00, 0xC0, 0x0D, 0x13, 0xC0, 0x07, 0x05, 0xC0,
+  0x0B, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x09, 0x00, 0xC0, 0x0C, 0x01, 0xC0,
+  0x08, 0x14, 0xC0, 0x04, 0x00, 0xC0, 0x07, 0x02, 0xC0, 0x08, 0x00, 0xC0,
+  0x0A, 0x0F, 0xC0, 0x07, 0x06, 0xC0, 0x02, 0x00, 0xC2, 0x07, 0x00, 0x06,
+  0x00, 0xC0, 0x06, 0x02, 0xC0, 0x08, 0x12, 0xC0, 0x0A, 0x00, 0xC0, 0x06,
+  0x00, 0xC2, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x08, 0x00, 0xC0, 0x0C, 0x18,
+  0xC2, 0x08, 0x00, 0x02, 0x18, 0xC0, 0x02, 0x00, 0xC0, 0x08, 0x02, 0xC0,
+  0x06, 0x00, 0xC0, 0x06, 0x17, 0xC0, 0x0C, 0x00, 0xC1, 0x09, 0x01, 0x00,
+  0xC1, 0x07, 0x02, 0x00, 0xC0, 0x0A, 0x17, 0xC0, 0x0D, 0x04, 0xC0, 0x04,
+  0x1A, 0xC0, 0x03, 0x00, 0xC0, 0x0B, 0x01, 0x3C, 0x00, 0xF5, 0x00, 0x41,
+  0x2D, 0xC0, 0x05, 0x06, 0xC0, 0x05, 0x17, 0xC0, 0x05, 0x04, 0xC0, 0x05,
+  0x18, 0xC0, 0x05, 0x04, 0xC0, 0x05, 0x11, 0xC0, 0x05, 0x06, 0xC0, 0x00,
+  0x02, 0xC0, 0x00, 0x06, 0xC0, 0x05, 0x0B, 0xC1, 0x05, 0x05, 0x0E, 0xC1,
+  0x05, 0x05, 0x0E, 0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x40, 0x29, 0x82, 0x05,
+  0x00, 0xC0, 0x00, 0x12, 0xC0, 0x00, 0x00, 0xC1, 0x05, 0x05, 0x40, 0x26,
+  0xC0, 0x00, 0x14, 0xC0, 0x00, 0x06, 0xC0, 0x05, 0x18, 0xC0, 0x05, 0x03,
+  0xC0, 0x05, 0x1C, 0xC0, 0x05, 0x40, 0x04, 0xC0, 0x00, 0x12, 0xC0, 0x00,
+  0x28, 0xC0, 0x05, 0x16, 0xC0, 0x05, 0x05, 0xC0, 0x05, 0x18, 0xC0, 0x05,
+  0x0A, 0xC0, 0x00, 0x06, 0xC0, 0x03, 0x00, 0xC0, 0x0D, 0x02, 0xC0, 0x00,
+  0x09, 0xC0, 0x05, 0x0A, 0xC0, 0x0B, 0x01, 0xC0, 0x01, 0x00, 0xC0, 0x09,
+  0x01, 0xC0, 0x0C, 0x10, 0xC0, 0x05, 0x04, 0xC1, 0x00, 0x07, 0x01, 0xC0,
+  0x00, 0x01, 0xC0, 0x08, 0x01, 0xC0, 0x05, 0x12, 0xC0, 0x04, 0x00, 0xC0,
+  0x02, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x06, 0x00, 0xC0, 0x0A, 0x0D, 0xC0,
+  0x05, 0x08, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x04, 0xC0, 0x05, 0x12, 0xC0,
+  0x06, 0x01, 0xC0, 0x00, 0x01, 0xC1, 0x05, 0x00, 0x01, 0xC0, 0x08, 0x13,
+  0xC0, 0x0A, 0x03, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x03, 0xC0, 0x0C, 0x0C,
+  0xC0, 0x05, 0x05, 0xC0, 0x05, 0x03, 0xC1, 0x00, 0x05, 0x05, 0xC0, 0x05,
+  0x12, 0xC0, 0x08, 0x06, 0xC0, 0x06, 0x14, 0xC0, 0x0C, 0x01, 0xC0, 0x09,
+  0x04, 0xC0, 0x02, 0x01, 0xC0, 0x0A, 0x12, 0xC0, 0x05, 0x03, 0xC0, 0x01,
+  0x00, 0xC1, 0x07, 0x05, 0x18, 0xC0, 0x0D, 0x06, 0xC0, 0x04, 0x19, 0xC0,
+  0x03, 0x00, 0xC0, 0x0B, 0x01, 0x3C, 0x00, 0xBC, 0x00, 0x42, 0x2E, 0xC0,
+  0x00, 0x04, 0xC0, 0x00, 0x10, 0xC0, 0x05, 0x14, 0xC0, 0x05, 0x0B, 0xC0,
+  0x00, 0x0E, 0xC0, 0x00, 0x41, 0x06, 0xC0, 0x05, 0x02, 0xC0, 0x00, 0x16,
+  0xC0, 0x00, 0x41, 0x05, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x40, 0xC0, 0x05,
+  0x40, 0x24, 0xC0, 0x00, 0x0A, 0xC0, 0x03, 0x02, 0xC0, 0x0D, 0x06, 0xC0,
+  0x00, 0x2F, 0xC0, 0x0B, 0x02, 0xC0, 0x01, 0x00, 0xC0, 0x09, 0x02, 0xC0,
+  0x0C, 0x15, 0xC0, 0x07, 0x06, 0xC0, 0x08, 0x10, 0xC0, 0x00, 0x07, 0xC0,
+  0x00, 0x00, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x06, 0xC0, 0x05, 0x09, 0xC1,
+  0x04, 0x02, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC1, 0x06, 0x0A,
+  0x14, 0xC0, 0x00, 0x04, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x02, 0xC0, 0x00,
+  0x00, 0xC0, 0x00, 0x13, 0xC0, 0x0A, 0x00, 0xC0, 0x06, 0x0A, 0xC0, 0x08,
+  0x00, 0xC0, 0x0C, 0x13, 0xC0, 0x00, 0x04, 0xC0, 0x00, 0x19, 0xC0, 0x00,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x0F, 0xC0, 0x05, 0x05, 0xC0,
+  0x08, 0x0A, 0xC0, 0x06, 0x01, 0xC0, 0x05, 0x0E, 0xC0, 0x0C, 0x0C, 0xC0,
+  0x0A, 0x13, 0xC0, 0x09, 0x06, 0xC0, 0x02, 0x14, 0xC0, 0x05, 0x03, 0xC0,
+  0x01, 0x00, 0xC1, 0x07, 0x05, 0x17, 0xC0, 0x0D, 0x08, 0xC0, 0x04, 0x17,
+  0xC0, 0x03, 0x02, 0xC0, 0x0B, 0x01, 0x3C, 0x00, 0xCE, 0x00, 0x41, 0x0D,
+  0xC0, 0x05, 0x06, 0xC0, 0x05, 0x37, 0xC0, 0x00, 0x04, 0xC0, 0x00, 0x2F,
+  0xC0, 0x05, 0x16, 0xC0, 0x05, 0x09, 0xC0, 0x00, 0x10, 0xC0, 0x00, 0x40,
+  0x2B, 0x82, 0x0E, 0x19, 0xC0, 0x00, 0x01, 0x82, 0x0E, 0x13, 0xC0, 0x00,
+  0x00, 0xC0, 0x05, 0x05, 0x82, 0x0E, 0x41, 0x18, 0xC0, 0x00, 0x41, 0x0C,
+  0xC0, 0x03, 0x02, 0xC0, 0x0D, 0x1A, 0xC0, 0x01, 0x02, 0xC0, 0x09, 0x0D,
+  0xC0, 0x00, 0x07, 0xC0, 0x0B, 0x0A, 0xC0, 0x0C, 0x03, 0xC0, 0x00, 0x0E,
+  0xC0, 0x07, 0x08, 0xC0, 0x08, 0x18, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x1A,
+  0xC0, 0x00, 0x04, 0xC0, 0x00, 0x12, 0xC0, 0x04, 0x00, 0xC0, 0x02, 0x01,
+  0xC0, 0x00, 0x06, 0xC0, 0x00, 0x01, 0xC0, 0x06, 0x00, 0xC0, 0x0A, 0x0A,
+  0xC0, 0x00, 0x10, 0xC0, 0x00, 0x04, 0xC0, 0x05, 0x0C, 0xC0, 0x00, 0x08,
+  0xC0, 0x00, 0x11, 0xC0, 0x06, 0x0E, 0xC0, 0x08, 0x0C, 0xC0, 0x0A, 0x03,
+  0xC0, 0x00, 0x04, 0xC0, 0x00, 0x07, 0xC0, 0x0C, 0x10, 0xC0, 0x00, 0x06,
+  0xC0, 0x00, 0x17, 0xC0, 0x00, 0x04, 0xC0, 0x00, 0x14, 0xC0, 0x08, 0x04,
+  0xC0, 0x00, 0x00, 0xC0, 0x00, 0x04, 0xC0, 0x06, 0x09, 0xC0, 0x05, 0x03,
+  0xC0, 0x0C, 0x10, 0xC1, 0x0A, 0x05, 0x2F, 0xC0, 0x09, 0x08, 0xC0, 0x02,
+  0x13, 0xC0, 0x0D, 0x02, 0xC0, 0x01, 0x02, 0xC0, 0x07, 0x02, 0xC0, 0x04,
+  0x12, 0xC0, 0x05, 0x06, 0xC0, 0x05, 0x1A, 0xC0, 0x03, 0x02, 0xC0, 0x0B,
+  0x00, 0x3C, 0x00, 0xC0, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF,
+  0x00, 0xBF, 0x00, 0xBF, 0x00, 0x88, 0x00, 0xC0, 0x0A, 0x9D, 0x00, 0x82,
+  0x0E, 0x9B, 0x00, 0xC0, 0x0B, 0x82, 0x0E, 0xC0, 0x04, 0x9B, 0x00, 0x82,
+  0x0E, 0x9D, 0x00, 0xC0, 0x0C, 0xBF, 0x00, 0xBF, 0x00, 0xBF, 0x00, 0xBF,
+  0x00, 0x87, 0x00, 0xC0, 0x01, 0x82, 0x00, 0xC0, 0x09, 0x9A, 0x00, 0xC0,
+  0x01, 0x82, 0x00, 0xC0, 0x09, 0x95, 0x00, 0xC1, 0x0B, 0x07, 0x8A, 0x00,
+  0xC1, 0x08, 0x0C, 0x92, 0x00, 0xC0, 0x07, 0x88, 0x00, 0xC0, 0x08, 0xBF,
+  0x00, 0x8F, 0x00, 0xC3, 0x04, 0x02, 0x00, 0x02, 0x8C, 0x00, 0xC3, 0x06,
+  0x00, 0x06, 0x0A, 0xBF, 0x00, 0x8C, 0x00, 0xC0, 0x06, 0x8E, 0x00, 0xC0,
+  0x08, 0x8B, 0x00, 0xC1, 0x0A, 0x06, 0x92, 0x00, 0xC1, 0x08, 0x0C, 0xBF,
+  0x00, 0x8C, 0x00, 0xC0, 0x08, 0x8C, 0x00, 0xC0, 0x06, 0x8E, 0x00, 0xC0,
+  0x08, 0x90, 0x00, 0xC0, 0x06, 0x8B, 0x00, 0xC0, 0x0C, 0x92, 0x00, 0xC0,
+  0x0A, 0x8F, 0x00, 0xC0, 0x09, 0x88, 0x00, 0xC0, 0x02, 0x93, 0x00, 0xC0,
+  0x09, 0x82, 0x00, 0xC0, 0x01, 0x82, 0x00, 0xC0, 0x07, 0x82, 0x00, 0xC0,
+  0x02, 0xB1, 0x00, 0xC0, 0x0D, 0x83, 0x00, 0xC0, 0x01, 0x82, 0x00, 0xC0,
+  0x07, 0x83, 0x00, 0xC0, 0x04, 0xB5, 0x00, 0xC0, 0x03, 0x82, 0x00, 0xC0,
+  0x0B, 0xBF, 0x00, 0x88, 0x00, 0x01, 0x3C, 0x00, 0x9C, 0x00, 0x44, 0x27,
+  0xC0, 0x0C, 0x00, 0xC0, 0x0A, 0x1B, 0xC0, 0x0D, 0x00, 0xC0, 0x06, 0x00,
+  0xC0, 0x04, 0x19, 0xC0, 0x03, 0x04, 0xC0, 0x0B, 0x18, 0xC1, 0x0B, 0x07,
+  0x02, 0xC1, 0x02, 0x04, 0x38, 0xC0, 0x04, 0x01, 0xC0, 0x08, 0x01, 0xC0,
+  0x0B, 0x19, 0xC1, 0x0A, 0x0C, 0x00, 0xC1, 0x0D, 0x03, 0x42, 0x04, 0xC0,
+  0x03, 0x04, 0xC0, 0x0D, 0x33, 0xC0, 0x0B, 0x04, 0xC0, 0x00, 0x02, 0xC0,
+  0x00, 0x04, 0xC0, 0x0C, 0x0F, 0xC0, 0x07, 0x0C, 0xC0, 0x08, 0x12, 0xC0,
+  0x00, 0x08, 0xC0, 0x00, 0x40, 0x0D, 0xC0, 0x04, 0x00, 0xC0, 0x02, 0x01,
+  0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x01, 0xC0, 0x06, 0x40, 0x0C, 0xC0, 0x00,
+  0x0E, 0xC0, 0x00, 0x0B, 0xC0, 0x06, 0x14, 0xC0, 0x08, 0x06, 0xC0, 0x0A,
+  0x40, 0x04, 0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x2D, 0xC0, 0x08, 0x12, 0xC0,
+  0x06, 0x0F, 0xC0, 0x00, 0x08, 0xC0, 0x00, 0x0D, 0xC0, 0x0C, 0x08, 0xC0,
+  0x00, 0x02, 0xC0, 0x00, 0x35, 0xC0, 0x09, 0x0C, 0xC0, 0x02, 0x2F, 0xC0,
+  0x0D, 0x04, 0xC0, 0x01, 0x02, 0xC0, 0x07, 0x04, 0xC0, 0x04, 0x01, 0x3C,
+  0x00, 0xB7, 0x00, 0x44, 0x07, 0xC0, 0x0C, 0x00, 0xC0, 0x0A, 0x1A, 0xC0,
+  0x0D, 0x00, 0xC0, 0x08, 0x00, 0xC0, 0x06, 0x00, 0xC0, 0x04, 0x17, 0xC0,
+  0x03, 0x00, 0xC0, 0x09, 0x02, 0xC0, 0x02, 0x00, 0xC0, 0x0B, 0x17, 0xC0,
+  0x01, 0x00, 0xC2, 0x09, 0x00, 0x07, 0x00, 0xC0, 0x07, 0x16, 0xC0, 0x0B,
+  0x00, 0xC0, 0x07, 0x00, 0x82, 0x00, 0x00, 0xC0, 0x02, 0x00, 0xC0, 0x04,
+  0x18, 0xC2, 0x02, 0x00, 0x01, 0x1A, 0xC0, 0x02, 0x04, 0xC0, 0x07, 0x17,
+  0xC0, 0x04, 0x00, 0xC1, 0x06, 0x08, 0x00, 0xC1, 0x09, 0x01, 0x00, 0xC0,
+  0x0B, 0x17, 0xC0, 0x0A, 0x04, 0xC0, 0x03, 0x1A, 0xC0, 0x0C, 0x00, 0xC0,
+  0x0D, 0x40, 0x25, 0xC0, 0x01, 0x04, 0xC0, 0x09, 0x18, 0xC0, 0x01, 0x04,
+  0xC0, 0x09, 0x32, 0xC1, 0x07, 0x07, 0x0E, 0xC1, 0x08, 0x08, 0x0F, 0xC0,
+  0x00, 0x0A, 0xC0, 0x00, 0x40, 0x2B, 0xC1, 0x02, 0x02, 0x01, 0xC0, 0x00,
+  0x10, 0xC0, 0x00, 0x40, 0x2B, 0xC0, 0x00, 0x12, 0xC0, 0x00, 0x07, 0xC0,
+  0x06, 0x1D, 0xC0, 0x06, 0x40, 0x03, 0xC0, 0x00, 0x10, 0xC0, 0x00, 0x40,
+  0x09, 0xC0, 0x08, 0x04, 0xC0, 0x00, 0x0A, 0xC0, 0x00, 0x0B, 0xC0, 0x08,
+  0x29, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x34, 0xC0, 0x09, 0x0E, 0xC0, 0x02,
+  0x2D, 0xC0, 0x09, 0x10, 0xC0, 0x02, 0x01, 0x3C, 0x00, 0xDB, 0x00, 0x43,
+  0x27, 0xC0, 0x0C, 0x00, 0xC0, 0x0A, 0x19, 0xC0, 0x0D, 0x01, 0xC0, 0x08,
+  0x00, 0xC0, 0x06, 0x01, 0xC0, 0x04, 0x17, 0xC0, 0x09, 0x04, 0xC0, 0x02,
+  0x15, 0xC0, 0x03, 0x00, 0xC0, 0x01, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x07,
+  0x00, 0xC0, 0x0B, 0x17, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x18, 0xC0, 0x07,
+  0x01, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x01, 0xC0, 0x02, 0x13, 0xC0, 0x0B,
+  0x03, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x03, 0xC0, 0x04, 0x18, 0xC0, 0x00,
+  0x1A, 0xC0, 0x02, 0x06, 0xC0, 0x07, 0x14, 0xC0, 0x04, 0x01, 0xC0, 0x06,
+  0x04, 0xC0, 0x01, 0x01, 0xC0, 0x0B, 0x17, 0xC0, 0x08, 0x00, 0xC0, 0x09,
+  0x19, 0xC0, 0x0A, 0x06, 0xC0, 0x03, 0x19, 0xC0, 0x0C, 0x00, 0xC0, 0x0D,
+  0x04, 0xC0, 0x05, 0x06, 0xC0, 0x05, 0x17, 0xC0, 0x05, 0x04, 0xC0, 0x05,
+  0x18, 0xC0, 0x05, 0x04, 0xC0, 0x05, 0x11, 0xC0, 0x05, 0x06, 0xC0, 0x00,
+  0x02, 0xC0, 0x00, 0x06, 0xC0, 0x05, 0x0B, 0xC1, 0x05, 0x05, 0x0E, 0xC1,
+  0x05, 0x05, 0x0E, 0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x40, 0x29, 0x82, 0x05,
+  0x00, 0xC0, 0x00, 0x12, 0xC0, 0x00, 0x40, 0x29, 0xC0, 0x00, 0x14, 0xC0,
+  0x00, 0x06, 0xC0, 0x05, 0x1D, 0xC0, 0x05, 0x1C, 0xC0, 0x05, 0x40, 0x04,
+  0xC0, 0x00, 0x12, 0xC0, 0x00, 0x28, 0xC0, 0x05, 0x1D, 0xC0, 0x05, 0x24,
+  0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x09, 0xC0, 0x05, 0x24, 0xC0, 0x05, 0x04,
+  0xC0, 0x00, 0x02, 0xC0, 0x00, 0x04, 0xC0, 0x05, 0x2D, 0xC0, 0x05, 0x10,
+  0xC0, 0x05, 0x01, 0x3C, 0x00, 0xA8, 0x00, 0x42, 0x26, 0xC0, 0x0C, 0x02,
+  0xC0, 0x0A, 0x37, 0xC0, 0x0D, 0x02, 0xC0, 0x08, 0x00, 0xC0, 0x06, 0x02,
+  0xC0, 0x04, 0x15, 0xC0, 0x09, 0x06, 0xC0, 0x02, 0x19, 0xC0, 0x00, 0x00,
+  0xC0, 0x00, 0x16, 0xC1, 0x03, 0x01, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00,
+  0x02, 0xC1, 0x07, 0x0B, 0x14, 0xC0, 0x00, 0x04, 0xC0, 0x00, 0x18, 0xC0,
+  0x00, 0x04, 0xC0, 0x00, 0x13, 0xC0, 0x0B, 0x00, 0xC0, 0x07, 0x0A, 0xC0,
+  0x02, 0x00, 0xC0, 0x04, 0x13, 0xC0, 0x00, 0x04, 0xC0, 0x00, 0x19, 0xC0,
+  0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x16, 0xC0, 0x02, 0x0A,
+  0xC0, 0x07, 0x11, 0xC0, 0x04, 0x0C, 0xC0, 0x0B, 0x13, 0xC0, 0x06, 0x06,
+  0xC0, 0x01, 0x19, 0xC0, 0x08, 0x00, 0xC0, 0x09, 0x18, 0xC0, 0x0A, 0x08,
+  0xC0, 0x03, 0x17, 0xC0, 0x0C, 0x02, 0xC0, 0x0D, 0x04, 0xC0, 0x00, 0x04,
+  0xC0, 0x00, 0x10, 0xC0, 0x05, 0x14, 0xC0, 0x05, 0x0B, 0xC0, 0x00, 0x0E,
+  0xC0, 0x00, 0x41, 0x06, 0xC0, 0x05, 0x02, 0xC0, 0x00, 0x41, 0x1D, 0xC0,
+  0x00, 0x40, 0x19, 0xC0, 0x05, 0x40, 0x24, 0xC0, 0x00, 0x41, 0x02, 0xC0,
+  0x00, 0x0E, 0xC0, 0x00, 0x06, 0xC0, 0x05, 0x01, 0x3C, 0x00, 0xA8, 0x00,
+  0x42, 0x06, 0xC0, 0x0C, 0x02, 0xC0, 0x0A, 0x1A, 0xC0, 0x08, 0x02, 0xC0,
+  0x06, 0x16, 0xC0, 0x0D, 0x0A, 0xC0, 0x04, 0x13, 0xC0, 0x09, 0x08, 0xC0,
+  0x02, 0x18, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x1A, 0xC0, 0x00, 0x04, 0xC0,
+  0x00, 0x12, 0xC0, 0x03, 0x00, 0xC0, 0x01, 0x01, 0xC0, 0x00, 0x06, 0xC0,
+  0x00, 0x01, 0xC0, 0x07, 0x00, 0xC0, 0x0B, 0x30, 0xC0, 0x00, 0x08, 0xC0,
+  0x00, 0x11, 0xC0, 0x07, 0x0E, 0xC0, 0x02, 0x20, 0xC0, 0x04, 0x10, 0xC0,
+  0x00, 0x06, 0xC0, 0x00, 0x17, 0xC0, 0x00, 0x04, 0xC0, 0x00, 0x14, 0xC0,
+  0x02, 0x04, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x04, 0xC0, 0x07, 0x0E, 0xC0,
+  0x04, 0x0E, 0xC0, 0x05, 0x00, 0xC0, 0x0B, 0x04, 0xC0, 0x05, 0x2A, 0xC0,
+  0x06, 0x08, 0xC0, 0x01, 0x01, 0xC0, 0x00, 0x04, 0xC0, 0x00, 0x0A, 0xC0,
+  0x0A, 0x02, 0xC0, 0x08, 0x02, 0xC0, 0x09, 0x02, 0xC0, 0x03, 0x17, 0xC0,
+  0x05, 0x1D, 0xC0, 0x0C, 0x02, 0xC0, 0x0D, 0x10, 0xC0, 0x00, 0x41, 0x08,
+  0xC0, 0x00, 0x1A, 0xC0, 0x05, 0x41, 0x21, 0xC0, 0x00, 0x40, 0x19, 0xC0,
+  0x05, 0x40, 0x24, 0xC0, 0x00, 0x41, 0x22, 0xC0, 0x00, 0x10, 0xC0, 0x00,
+  0x01, 0x3C, 0x00, 0x94, 0x00, 0x42, 0x06, 0xC0, 0x08, 0x02, 0xC0, 0x06,
+  0x35, 0xC1, 0x0D, 0x09, 0x0A, 0xC1, 0x02, 0x04, 0x16, 0xC0, 0x00, 0x00,
+  0xC0, 0x00, 0x19, 0xC0, 0x00, 0x06, 0xC0, 0x00, 0x31, 0xC0, 0x01, 0x01,
+  0xC0, 0x00, 0x0A, 0xC0, 0x00, 0x01, 0xC1, 0x07, 0x0B, 0x40, 0x0E, 0xC0,
+  0x00, 0x0A, 0xC0, 0x00, 0x22, 0xC1, 0x02, 0x04, 0x2D, 0xC0, 0x00, 0x0A,
+  0xC0, 0x00, 0x2F, 0xC0, 0x02, 0x03, 0xC0, 0x00, 0x06, 0xC0, 0x00, 0x01,
+  0xC0, 0x00, 0x00, 0xC0, 0x07, 0x04, 0xC0, 0x00, 0x0E, 0xC0, 0x00, 0x00,
+  0xC0, 0x00, 0x04, 0xC0, 0x00, 0x01, 0xC0, 0x0B, 0x03, 0xC0, 0x00, 0x29,
+  0xC0, 0x06, 0x0A, 0xC0, 0x01, 0x17, 0x82, 0x00, 0x12, 0xC0, 0x00, 0xC0,
+  0x00, 0x01, 0xC0, 0x0A, 0x03, 0xC0, 0x08, 0x02, 0xC0, 0x09, 0x03, 0xC0,
+  0x03, 0x35, 0xC0, 0x0C, 0x02, 0xC0, 0x0D, 0x40, 0x17, 0xC0, 0x00, 0x00,
+  0xC0, 0x00, 0x1B, 0xC0, 0x00, 0x42, 0xC0, 0x00, 0x1C, 0xC0, 0x00, 0x1D,
+  0xC0, 0x00, 0x41, 0x23, 0xC0, 0x00, 0x3C, 0xC0, 0x00, 0x01, 0x3C, 0x00,
+  0x6B, 0x00, 0x41, 0x25, 0xC0, 0x0C, 0x04, 0xC0, 0x0A, 0x33, 0xC0, 0x0D,
+  0x04, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x04, 0xC0, 0x04, 0x0F, 0xC0, 0x09,
+  0x0C, 0xC0, 0x02, 0x12, 0xC0, 0x00, 0x08, 0xC0, 0x00, 0x40, 0x12, 0xC0,
+  0x00, 0x0C, 0xC0, 0x00, 0x01, 0xC0, 0x07, 0x00, 0xC0, 0x0B, 0x40, 0x0A,
+  0xC0, 0x00, 0x0E, 0xC0, 0x00, 0x21, 0xC0, 0x02, 0x20, 0xC0, 0x04, 0x2A,
+  0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x40, 0x01, 0xC0, 0x07, 0x0F, 0xC0, 0x00,
+  0x08, 0xC0, 0x00, 0x17, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x08, 0xC0, 0x0B,
+  0x2B, 0xC0, 0x06, 0x0C, 0xC0, 0x01, 0x2F, 0xC0, 0x0A, 0x04, 0xC0, 0x08,
+  0x02, 0xC0, 0x09, 0x04, 0xC0, 0x03, 0x40, 0x13, 0xC0, 0x0C, 0x04, 0xC0,
+  0x0D, 0x01, 0x3C, 0x00, 0x61, 0x00, 0x41, 0x05, 0xC0, 0x08, 0x04, 0xC0,
+  0x06, 0x18, 0xC0, 0x08, 0x04, 0xC0, 0x06, 0x32, 0xC1, 0x09, 0x09, 0x0E,
+  0xC1, 0x02, 0x02, 0x0F, 0xC0, 0x00, 0x0A, 0xC0, 0x00, 0x40, 0x2F, 0xC0,
+  0x00, 0x10, 0xC0, 0x00, 0x01, 0xC1, 0x07, 0x07, 0x40, 0x3B, 0xC0, 0x00,
+  0x21, 0xC0, 0x02, 0x1F, 0xC0, 0x02, 0x27, 0xC0, 0x00, 0x10, 0xC0, 0x00,
+  0x40, 0x0F, 0xC0, 0x00, 0x0A, 0xC0, 0x00, 0x04, 0xC0, 0x07, 0x1F, 0xC0,
+  0x07, 0x0F, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x34, 0xC0, 0x06, 0x0E, 0xC0,
+  0x01, 0x2D, 0xC0, 0x06, 0x10, 0xC0, 0x01, 0x12, 0xC0, 0x08, 0x04, 0xC0,
+  0x09, 0x38, 0xC0, 0x08, 0x04, 0xC0, 0x09, 0x01, 0x3C, 0x00, 0x79, 0x00,
+  0x40, 0x24, 0xC0, 0x05, 0x06, 0xC0, 0x05, 0x17, 0xC0, 0x05, 0x04, 0xC0,
+  0x05, 0x18, 0xC0, 0x05, 0x04, 0xC0, 0x05, 0x19, 0xC0, 0x00, 0x02, 0xC0,
+  0x00, 0x06, 0xC0, 0x05, 0x0B, 0xC1, 0x05, 0x05, 0x0E, 0xC1, 0x05, 0x05,
+  0x0E, 0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x41, 0x01, 0xC0, 0x00, 0x00, 0x82,
+  0x05, 0x40, 0x3B, 0xC0, 0x00, 0x20, 0xC0, 0x05, 0x1F, 0xC0, 0x05, 0x20,
+  0xC0, 0x05, 0x38, 0xC0, 0x00, 0x40, 0x00, 0xC0, 0x05, 0x1F, 0xC0, 0x05,
+  0x0A, 0xC0, 0x00, 0x0C, 0xC0, 0x00, 0x25, 0xC0, 0x05, 0x08, 0xC0, 0x05,
+  0x04, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x04, 0xC0, 0x05, 0x2D, 0xC0, 0x05,
+  0x10, 0xC0, 0x05, 0x12, 0xC0, 0x05, 0x04, 0xC0, 0x05, 0x38, 0xC0, 0x05,
+  0x04, 0xC0, 0x05, 0x05, 0xC0, 0x05, 0x40, 0x10, 0xC0, 0x05, 0x06, 0xC0,
+  0x05, 0x01, 0x3C, 0x00, 0x3E, 0x00, 0x41, 0x25, 0xC0, 0x00, 0x04, 0xC0,
+  0x00, 0x26, 0xC0, 0x05, 0x0B, 0xC0, 0x00, 0x0E, 0xC0, 0x00, 0x41, 0x22,
+  0xC0, 0x00, 0x02, 0xC0, 0x05, 0x41, 0x1B, 0xC0, 0x00, 0x40, 0x23, 0xC0,
+  0x05, 0x40, 0x18, 0xC0, 0x00, 0x40, 0x2A, 0xC0, 0x00, 0x0E, 0xC0, 0x00,
+  0x26, 0xC0, 0x05, 0x2B, 0xC0, 0x00, 0x04, 0xC0, 0x00, 0x41, 0x06, 0xC0,
+  0x05, 0x40, 0x0F, 0xC0, 0x05, 0x06, 0xC0, 0x05,
+};
+const uint32_t animClimbBurstSize = sizeof(animClimbBurst);
@@ -0,0 +1,49 @@
+// © 2025 SC5K Systems
+
+#include "src/arena.h"
+#include <Arduino.h>
+#include <string.h>
+#include <stdio.h>
+
+ModeArena arena;
+
+static ArenaOwner owner = ARENA_FREE;
+static uint32_t   claims = 0;
+
+// footprint of each owner's working set, indexed by ArenaOwner
+static const uint16_t setBytes[ARENA_OWNERS] = {
+  0,
+  sizeof(PerryState),
+  sizeof(AudioState),
+  sizeof(AutonomousState),
+  sizeof(DynamicState),
+  sizeof(ShutdownState)
+};
+static const char *const setNames[ARENA_OWNERS] = {
+  "free", "perry", "audio", "autonomous", "dynamic", "shutdown"
+};
+
+void arenaClaim(ArenaOwner who) {
+  memset(&arena, 0, setBytes[who]);
+  owner = who;
+  claims++;
+}
+
+ArenaOwner arenaOwner() {
+  return owner;
+}
+
+void arenaReport() {
+  char line[64];
+  uint32_t separate = 0;
+  for (uint8_t i = 1; i < ARENA_OWNERS; i++) separate += setBytes[i];
+  snprintf(line, sizeof(line), "arena: %u bytes (%lu if each mode kept its own)",
+           (unsigned)sizeof(arena), (unsigned long)separate);
+  Serial.println(line);
+  for (uint8_t i = 1; i < ARENA_OWNERS; i++) {
+    snprintf(line, sizeof(line), "  %-10s %5u%s", setNames[i], setBytes[i], i == owner ? "  <- owner" : "");
+    Serial.println(line);
+  }
+  snprintf(line, sizeof(line), "  %lu claims", (unsigned long)claims);
+  Serial.println(line);
+}
@@ -3,26 +3,47 @@
 #include "src/audio_vis.h"
 #include "src/helpers.h"
 #include "src/checklist.h"
+#include "src/profiler.h"
+#include "src/cpu.h"
+#include "src/clock.h"
+#include "src/arena.h"
 #include "arduinoFFT.h"
+#include <string.h>
 
 // readFFT
+// the window is two frames long: last frame's half shifts down and the newest half is sampled
+// behind it, so the bins are twice as fine while a frame still waits for only samples/2 readings
 void readFFT() {
-  unsigned long nextMicros = micros();
+  PROFILE_SCOPE("readFFT");
+  const int half = samples / 2;
+  memcpy(smoothedInput, smoothedInput + half, half * sizeof(float));
+  unsigned long nextMicros = clockMicros();
+  for (int i = 0; i < half; i++) {
+    cpuWaitMicros(nextMicros);
+    float raw = analogRead(MIC_PIN);
+    raw = min(raw, 1023.0f);
+    // smoothed against the same slot of the previous half, as before the window grew
+    smoothedInput[half + i] = (smoothedInput[i] * (smoothingFactor - 1) + raw) / smoothingFactor;
+    nextMicros += sampleDelay;
+  }
+  fftBars();
+}
+
+// fftBars: window the sample buffer, transform it and set the bar heights
+void fftBars() {
   for (int i = 0; i < samples; i++) {
-    while (micros() < nextMicros);
-    double raw = analogRead(MIC_PIN);
-    raw = min(raw, 1023.0);
-    smoothedInput[i] = (smoothedInput[i] * (smoothingFactor - 1) + raw) / smoothingFactor;
     vReal[i] = smoothedInput[i];
     vImag[i] = 0;
-    nextMicros += sampleDelay;
   }
   FFT.windowing(FFTWindow::Hamming, FFTDirection::Forward);
   FFT.compute(FFTDirection::Forward);
   FFT.complexToMagnitude();
+  // two fine bins per bar keep the bars on the same frequencies; the louder of the pair,
+  // halved, keeps a tone at the height a single bin of the shorter window gave it
   for (int i = 2; i < (WIDTH/3) + 2; i++) {
     int idx = i - 2;
-    int h = map((int)vReal[i], 0, 1023, 1, MAX_BAR_HEIGHT);
+    float mag = max(vReal[2*i], vReal[2*i + 1]) * 0.5f;
+    int h = map((int)mag, 0, 1023, 1, MAX_BAR_HEIGHT);
     barHeights[idx] = min(h, MAX_BAR_HEIGHT);
     redlined[idx]   = (barHeights[idx] > MAX_BAR_HEIGHT * 0.6);
   }
@@ -30,7 +51,7 @@ void readFFT() {
 
 // updatePeaks
 void updatePeaks() {
-  unsigned long now = millis();
+  unsigned long now = clockMillis();
   for (int i = 0; i < WIDTH/3; i++) {
     if (barHeights[i] > peakLevels[i]) {
       peakLevels[i] = barHeights[i];
@@ -61,63 +82,56 @@ uint16_t getBarColor(int y, int h) {
 }
 
 // drawWaveform
+// one mic sample per portrait row; the trace swings left/right across the short axis
 void drawWaveform() {
-  const int rawW = WIDTH, rawH = HEIGHT;
-  const int midY = rawH/2 - 4, scaleY = rawH/2;
-  int dispW = matrix.width(), dispH = matrix.height();
+  const int16_t w = matrix.width(), h = matrix.height();
+  const int midX = w/2 + 3, scale = w/2;
+  const uint16_t cyan = matrix.color565(0,255,255);
+  uint16_t *fb = matrix.getBuffer();
 
-  for (int rx = 0; rx < rawW; rx++) {
+  for (int16_t y = 0; y < h; y++) {
     double raw = analogRead(MIC_PIN);
     raw = min(raw, 1023.0);
     int16_t v = int(raw) - 512;
-    int16_t dy = (v * scaleY) / 512;
-    int16_t ry = constrain(midY - dy, 0, rawH - 1);
-    int dx = (dispW - 1) - ry + WAVE_X_SHIFT;
-    int dy2 = rx;
-    if (dx >= 0 && dx < dispW && dy2 >= 0 && dy2 < dispH) {
-      matrix.drawPixel(dx, dy2, matrix.color565(0,255,255));
-    }
+    int16_t dx = (v * scale) / 512;
+    int x = constrain(midX + dx, 0, w - 1) + WAVE_X_SHIFT;
+    if (x >= 0 && x < w) fb[y * w + x] = cyan;
   }
 }
 
 // drawBars
+// bars run down the long axis, mirrored in from both long edges; written straight into the canvas
 void drawBars() {
-  const int rawW = WIDTH, rawH = HEIGHT;
+  PROFILE_SCOPE("drawBars");
+  const int16_t w = matrix.width(), h = matrix.height();
   const int barW = 2, barGap = 1;
   int numBars = WIDTH/3;
-  int blockW = numBars*(barW+barGap) - barGap;
-  int offsetX = (rawW - blockW)/2;
-  int dispW = matrix.width();
+  int blockH = numBars*(barW+barGap) - barGap;
+  int offsetY = (h - blockH)/2;
+  uint16_t *fb = matrix.getBuffer();
 
   for (int i = 0; i < numBars; i++) {
-    int rx = offsetX + i*(barW+barGap);
+    uint16_t *row = fb + (offsetY + i*(barW+barGap)) * w;
 
     // fill bars
-    for (int ryOff = 0; ryOff < barHeights[i]; ryOff++) {
-      int rawYb = rawH - 1 - ryOff;
-      int rawYt = ryOff;
+    for (int d = 0; d < barHeights[i]; d++) {
       uint16_t c = redlined[i]
         ? matrix.color565(255,0,128)
-        : getBarColor(ryOff, barHeights[i]);
-
-      int dx1 = dispW - 1 - rawYb;
-      matrix.drawFastVLine(dx1, rx, barW, c);
-
-      int dx2 = dispW - 1 - rawYt;
-      matrix.drawFastVLine(dx2, rx, barW, c);
+        : getBarColor(d, barHeights[i]);
+      for (int k = 0; k < barW; k++) {
+        row[k*w + d]         = c;
+        row[k*w + w - 1 - d] = c;
+      }
     }
 
     // peaks
-    int rawPb = rawH - 1 - peakLevels[i];
-    int dxp1 = dispW - 1 - rawPb;
     uint16_t pk = redlined[i]
       ? matrix.color565(255,0,128)
       : matrix.color565(0,255,0);
-    matrix.drawFastVLine(dxp1, rx, barW, pk);
-
-    int rawPt = peakLevels[i];
-    int dxp2 = dispW - 1 - rawPt;
-    matrix.drawFastVLine(dxp2, rx, barW, pk);
+    for (int k = 0; k < barW; k++) {
+      row[k*w + peakLevels[i]]         = pk;
+      row[k*w + w - 1 - peakLevels[i]] = pk;
+    }
   }
 }
 
@@ -133,12 +147,10 @@ void initAudioVis() {
     peakLevels[i] = 0;
     peakTimes[i]  = 0;
   }
-  for (int i = 0; i < samples; i++) {
-    smoothedInput[i] = 0.0;
-  }
+  arenaClaim(ARENA_AUDIO);
 
   audioActive    = true;
-  audioStartTime = millis();
+  audioStartTime = clockMillis();
   matrix.fillScreen(0);
 }
 
@@ -152,7 +164,7 @@ void runAudioVisFrame() {
     drawChecklistStatic();
     return;
   }
-  if (millis() - audioStartTime >= audioDuration) {
+  if (clockMillis() - audioStartTime >= audioDuration) {
     audioActive   = false;
     readyTimestamp = 0;
     return;
@@ -163,5 +175,4 @@ void runAudioVisFrame() {
   drawWaveform();
   drawBars();
   matrix.show();
-  delay(1);
 }
@@ -3,8 +3,56 @@
 #include "src/autonomous.h"
 #include "src/globals.h"
 #include "src/matrix_config.h"
+#include "src/text.h"
+#include "src/clock.h"
+#include "src/arena.h"
 #include <Arduino.h>
 #include <math.h>
+#include <string.h>
+
+// pixels generated by the primitives of the last autonomous frame (see ?clip)
+static uint32_t lastFrameVisits = 0;
+
+// draw autonomous rings: expanding circles, static outer circles and spokes around the centre.
+// most of this lies off the 32-wide canvas, which is what the clipped primitives skip.
+static void drawDynamicRings(int16_t cx, int16_t cy) {
+  uint16_t dcol = matrix.color565(0,0,28);
+  for (int i = 0; i < DYN_CIRCLES; i++) {
+    matrix.drawCircle(cx, cy, dynRadius[i], dcol);
+  }
+}
+
+// the outer circles and spokes never move, so live frames take them from the arena layer
+static void drawStaticRings(int16_t cx, int16_t cy) {
+  uint16_t scol = matrix.color565(16,16,50);
+  matrix.drawCircle(cx, cy, 50, scol);
+  matrix.drawCircle(cx, cy, 15, scol);
+  const float step = TWO_PI/16;
+  for (int i = 0; i < 16; i++) {
+    if (i % 4 == 0) continue;
+    float a = i * step;
+    int16_t x2 = cx + cos(a) * (50 + 6);
+    int16_t y2 = cy + sin(a) * (50 + 6);
+    matrix.drawLine(cx, cy, x2, y2, scol);
+    matrix.fillCircle(x2, y2, 2, scol);
+  }
+}
+
+// overlayStaticRings: the cached static rings over the frame so far; black in the layer is
+// transparent
+static void overlayStaticRings() {
+  uint16_t *buf = matrix.getBuffer();
+  const uint16_t *layer = arena.autonomous.layer;
+  for (uint16_t i = 0; i < WIDTH * HEIGHT; i++) {
+    if (layer[i]) buf[i] = layer[i];
+  }
+}
+
+// both, drawn live; the ?clip benchmark measures this
+static void drawAutonomousRings(int16_t cx, int16_t cy) {
+  drawDynamicRings(cx, cy);
+  drawStaticRings(cx, cy);
+}
 
 // reset star: center star and randomize direction & speed
 void resetStar(Star &s) {
@@ -22,10 +70,18 @@ void resetStar(Star &s) {
 // init autonomous: clear state, seed stars and circles, compute auto‑lock box coords
 void initAutonomous() {
   autoActive   = true;
-  autoStarPrev = millis();
-  autoTextPrev = millis();
+  autoTextPrev = clockMillis();
   autoState    = false;
 
+  arenaClaim(ARENA_AUTONOMOUS);
+
+  // render the static rings once on black; each frame lays their lit pixels over the moving
+  // rings, which is the order drawAutonomousRings() draws them in
+  int16_t cx = matrix.width()/2;
+  int16_t cy = matrix.height()/2;
+  matrix.fillScreen(0);
+  drawStaticRings(cx, cy);
+  memcpy(arena.autonomous.layer, matrix.getBuffer(), sizeof(arena.autonomous.layer));
   matrix.fillScreen(0);
 
   // seed stars and dynamic circles
@@ -33,8 +89,6 @@ void initAutonomous() {
   for (int i = 0; i < DYN_CIRCLES; i++) dynRadius[i] = 1;
 
   // calculate center-based coords for "AUTO LOCK" box
-  int16_t cx = matrix.width()/2;
-  int16_t cy = matrix.height()/2;
   tX1 = cx - 2*CHAR_W;
   tY1 = cy - 10;
   tX2 = cx - 2*CHAR_W;
@@ -44,12 +98,12 @@ void initAutonomous() {
   boxW = 34;
   boxH = 28;
 
-  startTime = millis();
+  startTime = clockMillis();
 }
 
 // run autonomous frame: blink text, draw circles and stars, and draw auto‑lock box each cycle
 void runAutonomousFrame() {
-  unsigned long now = millis();
+  unsigned long now = clockMillis();
 
   // toggle blink state for auto text
   if (now - autoTextPrev >= textInterval) {
@@ -57,65 +111,88 @@ void runAutonomousFrame() {
     autoState = !autoState;
   }
 
-  // update circles and stars each tick
-  if (now - autoStarPrev >= starInterval) {
-    autoStarPrev = now;
-    matrix.fillScreen(matrix.color565(0,0,8));
-
-    int16_t cx = matrix.width()/2;
-    int16_t cy = matrix.height()/2;
+  // update circles and stars; the pacer runs this at the mode's 25 fps
+  matrix.pixelVisits = 0;
+  matrix.fillScreen(matrix.color565(0,0,8));
 
-    // animated circles
-    uint16_t dcol = matrix.color565(0,0,28);
-    for (int i = 0; i < DYN_CIRCLES; i++) {
-      matrix.drawCircle(cx, cy, dynRadius[i], dcol);
-      if (++dynRadius[i] > maxDynRadius) dynRadius[i] = 1;
-    }
+  int16_t cx = matrix.width()/2;
+  int16_t cy = matrix.height()/2;
 
-    // static outer circles and spokes
-    uint16_t scol = matrix.color565(16,16,50);
-    matrix.drawCircle(cx, cy, 50, scol);
-    matrix.drawCircle(cx, cy, 15, scol);
-    const float step = TWO_PI/16;
-    for (int i = 0; i < 16; i++) {
-      if (i % 4 == 0) continue;
-      float a = i * step;
-      int16_t x2 = cx + cos(a) * (50 + 6);
-      int16_t y2 = cy + sin(a) * (50 + 6);
-      matrix.drawLine(cx, cy, x2, y2, scol);
-      matrix.fillCircle(x2, y2, 2, scol);
+  drawDynamicRings(cx, cy);
+  for (int i = 0; i < DYN_CIRCLES; i++) {
+    if (++dynRadius[i] > maxDynRadius) dynRadius[i] = 1;
+  }
+  overlayStaticRings();
+
+  // update and draw stars
+  for (int i = 0; i < MAX_STARS; i++) {
+    Star &s = stars[i];
+    s.accX += s.stepX;
+    s.accY += s.stepY;
+    int16_t dx = int(floor(s.accX));
+    int16_t dy = int(floor(s.accY));
+    if (dx) { s.xInt += dx; s.accX -= dx; }
+    if (dy) { s.yInt += dy; s.accY -= dy; }
+    if (s.xInt < 0 || s.xInt >= matrix.width() ||
+        s.yInt < 0 || s.yInt >= matrix.height()) {
+      resetStar(s);
+    } else {
+      matrix.drawPixel(s.xInt, s.yInt, matrix.color565(255,255,255));
     }
+  }
 
-    // update and draw stars
-    for (int i = 0; i < MAX_STARS; i++) {
-      Star &s = stars[i];
-      s.accX += s.stepX;
-      s.accY += s.stepY;
-      int16_t dx = int(floor(s.accX));
-      int16_t dy = int(floor(s.accY));
-      if (dx) { s.xInt += dx; s.accX -= dx; }
-      if (dy) { s.yInt += dy; s.accY -= dy; }
-      if (s.xInt < 0 || s.xInt >= matrix.width() ||
-          s.yInt < 0 || s.yInt >= matrix.height()) {
-        resetStar(s);
-      } else {
-        matrix.drawPixel(s.xInt, s.yInt, matrix.color565(255,255,255));
-      }
-    }
+  // draw the auto‑lock box with colours based on blink state
+  uint16_t boxCol = autoState ?
+    matrix.color565(255,255,0) : matrix.color565(255,0,0);
+  uint16_t txtCol = autoState ?
+    matrix.color565(255,0,0) : matrix.color565(255,215,0);
 
-    // draw the auto‑lock box with colours based on blink state
-    uint16_t boxCol = autoState ?
-      matrix.color565(255,255,0) : matrix.color565(255,0,0);
-    uint16_t txtCol = autoState ?
-      matrix.color565(255,0,0) : matrix.color565(255,215,0);
+  matrix.fillRect(boxX, boxY, boxW, boxH, boxCol);
+  textDrawLabel(tX1, tY1, line1, txtCol);
+  textDrawLabel(tX2, tY2, line2, txtCol);
 
-    matrix.fillRect(boxX, boxY, boxW, boxH, boxCol);
-    matrix.setTextColor(txtCol);
-    matrix.setCursor(tX1, tY1);
-    matrix.print(line1);
-    matrix.setCursor(tX2, tY2);
-    matrix.print(line2);
+  lastFrameVisits = matrix.pixelVisits;
+  matrix.show();
+}
 
-    matrix.show();
+// bench autonomous clip: render one full ring cycle (every dynRadius) with GFX clipping and
+// with the analytic clipping, reporting pixels generated and time per frame for each
+void benchAutonomousClip() {
+  int16_t cx = matrix.width()/2;
+  int16_t cy = matrix.height()/2;
+  int saved[DYN_CIRCLES];
+  for (int i = 0; i < DYN_CIRCLES; i++) saved[i] = dynRadius[i];
+  bool wasFast = matrix.clipFast;
+  matrix.saveCanvas();
+
+  Serial.print("autonomous frame, ");
+  Serial.print(maxDynRadius);
+  Serial.println(" ring phases:");
+  for (uint8_t pass = 0; pass < 2; pass++) {
+    matrix.clipFast = (pass == 1);
+    uint32_t visits = 0;
+    unsigned long t0 = micros();
+    for (int r = 1; r <= maxDynRadius; r++) {
+      for (int i = 0; i < DYN_CIRCLES; i++) dynRadius[i] = r;
+      matrix.pixelVisits = 0;
+      matrix.fillScreen(matrix.color565(0,0,8));
+      drawAutonomousRings(cx, cy);
+      matrix.fillRect(boxX, boxY, boxW, boxH, matrix.color565(255,255,0));
+      visits += matrix.pixelVisits;
+    }
+    unsigned long us = micros() - t0;
+    Serial.print(pass ? "  clipped: " : "  gfx:     ");
+    Serial.print(visits / maxDynRadius);
+    Serial.print(" px visited/frame, ");
+    Serial.print((float)us / maxDynRadius, 1);
+    Serial.println(" us/frame");
   }
+
+  for (int i = 0; i < DYN_CIRCLES; i++) dynRadius[i] = saved[i];
+  matrix.clipFast = wasFast;
+  matrix.restoreCanvas();
+  Serial.print("  live: ");
+  Serial.print(lastFrameVisits);
+  Serial.print(" px visited last frame, clipping ");
+  Serial.println(matrix.clipFast ? "fast" : "gfx");
 }
@@ -0,0 +1,304 @@
+// © 2025 SC5K Systems
+
+#include "src/bench.h"
+#include "src/globals.h"
+#include "src/matrix_config.h"
+#include "src/boot_sequence.h"
+#include "src/checklist.h"
+#include "src/sponsor_scroller.h"
+#include "src/perry_loader.h"
+#include "src/audio_vis.h"
+#include "src/autonomous.h"
+#include "src/dynamic.h"
+#include "src/shutdown.h"
+#include "src/mode.h"
+#include "src/message.h"
+#include "src/helpers.h"
+#include "src/profiler.h"
+#include "src/journal.h"
+#include <Arduino.h>
+#include <math.h>
+#include <stdio.h>
+
+// each state runs its own frame function with show() held, so a row is the cost of drawing
+// that state and nothing of the panel conversion, which is timed once at the end
+
+static void printRow(const char *name, unsigned long us, uint16_t frames) {
+  char line[48];
+  unsigned long fps10 = us ? (unsigned long)((uint64_t)frames * 10000000ULL / us) : 0;
+  snprintf(line, sizeof(line), "  %-14s %8lu %7lu.%lu", name, us / frames, fps10 / 10, fps10 % 10);
+  Serial.println(line);
+}
+
+static void timeFrames(const char *name, void (*frame)(), uint16_t frames) {
+  unsigned long t0 = micros();
+  for (uint16_t i = 0; i < frames; i++) frame();
+  printRow(name, micros() - t0, frames);
+}
+
+// 1 kHz and 3.2 kHz around mid-scale in place of the mic, so every run sees the same bars
+static void syntheticTone() {
+  for (int i = 0; i < samples; i++) {
+    float t = i / (float)samplingFrequency;
+    smoothedInput[i] = 512 + 300 * sinf(TWO_PI * 1000 * t) + 150 * sinf(TWO_PI * 3200 * t);
+  }
+}
+
+// audioFrame: runAudioVisFrame() without the mic sampling
+static void audioFrame() {
+  fftBars();
+  updatePeaks();
+  matrix.fillScreen(0);
+  drawWaveform();
+  drawBars();
+  matrix.show();
+}
+
+static void showFrame() {
+  matrix.show();
+}
+
+static void dynamicState(uint8_t req, uint8_t intake, uint8_t score, uint8_t climb) {
+  Message m = {};
+  m.hasMode    = true;
+  m.mode       = MODE_DYNAMIC;
+  m.format     = PAYLOAD_DYNAMIC;
+  m.fieldCount = 4;
+  m.payload.dynamic = { req, intake, score, climb };
+  updateDynamicFromMessage(m);
+}
+
+// benchIdle: the benches draw over the canvas, take the arena and start the mode over, so
+// they only run before a match: boot animation over, and no mode yet or a checklist whose
+// ready chain (sponsor, perry, audio) hasn't started
+bool benchIdle(const char *name) {
+  bool chain = readyTimestamp || audioActive || sponsorLaunched || perryActive;
+  if (!bootRunning() && (currentMode == MODE_NULL || (currentMode == MODE_CHECKLIST && !chain))) {
+    return true;
+  }
+  Serial.print(name);
+  Serial.println(": only before a match, once the boot animation is over");
+  return false;
+}
+
+// restoreMode: drop the chain flags the timed states set, start the running mode over and
+// let the journal record again
+static void restoreMode() {
+  audioActive = sponsorLaunched = perryActive = false;
+  readyTimestamp = 0;
+  modeRestore();
+  journalSuspend(false);
+}
+
+void benchModes(uint16_t frames) {
+  if (!benchIdle("bench")) return;
+  if (!frames) frames = BENCH_FRAMES;
+  // the dynamic states are set with made-up messages; keep them out of the match journal
+  journalSuspend(true);
+  char name[16];
+  Serial.print("bench, ");
+  Serial.print(frames);
+  Serial.println(" frames per state, panel held:");
+  Serial.println("  state          us/frame     fps");
+  matrix.offscreen = true;
+
+  // all red, NOT READY: the busiest checklist screen
+  bool ready = gReadyState;
+  int saved[MSG_MAX_FIELDS];
+  for (uint8_t i = 0; i < numChecklist; i++) {
+    saved[i] = prevChecklist[i];
+    prevChecklist[i] = 0;
+  }
+  gReadyState = false;
+  timeFrames("checklist", drawChecklistStatic, frames);
+  for (uint8_t i = 0; i < numChecklist; i++) prevChecklist[i] = saved[i];
+  gReadyState = ready;
+
+  initSponsorScroller();
+  timeFrames("sponsor", runSponsorScroller, frames);
+  initPerryLoader();
+  timeFrames("perry", displayRandomText4, frames);
+  initAudioVis();
+  syntheticTone();
+  timeFrames("audio", audioFrame, frames);
+  initAutonomous();
+  timeFrames("autonomous", runAutonomousFrame, frames);
+
+  initDynamic();
+  dynamicState(1, 0, 0, 0);
+  timeFrames("dyn request", runDynamicFrame, frames);
+  dynamicState(1, 1, 0, 0);
+  timeFrames("dyn intake", runDynamicFrame, frames);
+  for (uint8_t level = 1; level <= 4; level++) {
+    dynamicState(0, 0, level, 0);
+    snprintf(name, sizeof(name), "dyn score %u", level);
+    timeFrames(name, runDynamicFrame, frames);
+  }
+  for (uint8_t climb = 1; climb <= 3; climb++) {
+    dynamicState(0, 0, 0, climb);
+    snprintf(name, sizeof(name), "dyn climb %u", climb);
+    timeFrames(name, runDynamicFrame, frames);
+  }
+
+  initShutdown();
+  timeFrames("shutdown", runShutdownFrame, frames);
+
+  // put the running mode back, then time show() on the frame it draws
+  matrix.offscreen = false;
+  restoreMode();
+  timeFrames("show()", showFrame, frames);
+  Serial.print("  live audio frames also wait ");
+  Serial.print((unsigned long)(samples / 2) * sampleDelay);
+  Serial.println(" us for mic samples");
+}
+
+// kernels: each call takes the call index so the inputs move and nothing folds to a constant,
+// and leaves its result in a volatile so the call is not dropped
+
+static volatile uint32_t sink;
+static uint16_t shuffleBuf[64];
+static int16_t  segPts[64][2];
+static int16_t  dashX, dashY, dashW, dashH;
+
+static void kNone(uint16_t i) {
+  sink += i;
+}
+
+static void kHsv(uint16_t i) {
+  uint8_t r, g, b;
+  hsvToRgb((float)(i % 360), 1.0f, 1.0f - (i & 7) * 0.1f, r, g, b);
+  sink += r + g + b;
+}
+
+static void kWheel(uint16_t i) {
+  sink += wheel((uint8_t)i);
+}
+
+static void kShuffle(uint16_t i) {
+  shuffleArray(shuffleBuf, 64);
+  sink += shuffleBuf[i & 63];
+}
+
+static void kRandomChar(uint16_t i) {
+  sink += getRandomChar() + i;
+}
+
+static void kDashed(uint16_t i) {
+  drawDashedOutline(dashX, dashY, dashW, dashH, 2 * (dashW + dashH) - 4, i % 3, 0x07E0);
+}
+
+static void kSegIntersect(uint16_t i) {
+  const int16_t *a = segPts[i & 63], *b = segPts[(i + 1) & 63];
+  const int16_t *c = segPts[(i * 7 + 3) & 63], *d = segPts[(i * 7 + 4) & 63];
+  sink += segIntersect(a[0], a[1], b[0], b[1], c[0], c[1], d[0], d[1]);
+}
+
+static void kRotProj(uint16_t i) {
+  static const float v[3] = { 1.0f, -1.0f, 1.0f };
+  int16_t x, y;
+  rotProj(v, (i & 63) * 0.05f, (i & 31) * -0.08f, x, y, 32, 16);
+  sink += x + y;
+}
+
+static void kBarColor(uint16_t i) {
+  sink += getBarColor(i % MAX_BAR_HEIGHT, MAX_BAR_HEIGHT);
+}
+
+static void kScoreBars(uint16_t i) {
+  updateScoreBars();
+  sink += i;
+}
+
+static void kPeaks(uint16_t i) {
+  barHeights[i % (WIDTH / 3)] = i % MAX_BAR_HEIGHT;
+  updatePeaks();
+}
+
+struct Kernel {
+  const char *name;
+  void      (*call)(uint16_t);
+};
+
+static const Kernel kernels[] = {
+  { "hsvToRgb",          kHsv },
+  { "wheel",             kWheel },
+  { "shuffleArray/64",   kShuffle },
+  { "getRandomChar",     kRandomChar },
+  { "drawDashedOutline", kDashed },
+  { "segIntersect",      kSegIntersect },
+  { "rotProj",           kRotProj },
+  { "getBarColor",       kBarColor },
+  { "updateScoreBars",   kScoreBars },
+  { "updatePeaks",       kPeaks },
+};
+
+// ticksNs: profiler ticks to ns; cycles on target, already ns on host
+static float ticksNs(float ticks) {
+#ifdef ARDUINO
+  return ticks * 1000.0f / (SystemCoreClock / 1000000UL);
+#else
+  return ticks;
+#endif
+}
+
+// timeBatches: ns/call of each batch into 'ns', minus 'base'; returns the mean
+static float timeBatches(void (*call)(uint16_t), uint16_t calls, float base, float *ns) {
+  float sum = 0;
+  for (uint8_t b = 0; b < BENCH_KERNEL_BATCHES; b++) {
+    uint16_t i0 = b * calls;
+    uint32_t t0 = profNow();
+    for (uint16_t i = 0; i < calls; i++) call(i0 + i);
+    ns[b] = ticksNs(profNow() - t0) / calls - base;
+    sum += ns[b];
+  }
+  return sum / BENCH_KERNEL_BATCHES;
+}
+
+void benchKernels(uint16_t calls) {
+  if (!benchIdle("mb")) return;
+  if (!calls) calls = BENCH_KERNEL_CALLS;
+  journalSuspend(true);
+
+  for (uint8_t i = 0; i < 64; i++) {
+    shuffleBuf[i] = i;
+    segPts[i][0] = random(0, matrix.width());
+    segPts[i][1] = random(0, matrix.height());
+  }
+  dashX = 2;
+  dashY = 2;
+  dashW = matrix.width() - 4;
+  dashH = matrix.height() - 4;
+  initDynamic();
+  dynamicState(0, 0, 3, 0);
+
+  float ns[BENCH_KERNEL_BATCHES];
+  float base = timeBatches(kNone, calls, 0, ns);
+  char line[64];
+  Serial.print("mb, ");
+  Serial.print(BENCH_KERNEL_BATCHES);
+  Serial.print(" batches of ");
+  Serial.print(calls);
+  Serial.print(" calls, less ");
+  Serial.print((unsigned long)(base + 0.5f));
+  Serial.println(" ns empty call:");
+  Serial.println("  kernel             ns/call    +-95%     min");
+
+  // 95% interval of the mean: t(0.975, 15 df) * sd / sqrt(batches)
+  static_assert(BENCH_KERNEL_BATCHES == 16, "t95 is for 15 degrees of freedom");
+  const float t95 = 2.131f;
+  for (uint8_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+    float mean = timeBatches(kernels[k].call, calls, base, ns);
+    float var = 0, lo = ns[0];
+    for (uint8_t b = 0; b < BENCH_KERNEL_BATCHES; b++) {
+      var += (ns[b] - mean) * (ns[b] - mean);
+      if (ns[b] < lo) lo = ns[b];
+    }
+    float ci = t95 * sqrtf(var / (BENCH_KERNEL_BATCHES - 1)) / sqrtf(BENCH_KERNEL_BATCHES);
+    snprintf(line, sizeof(line), "  %-18s %8ld %8lu %7ld", kernels[k].name, lroundf(mean),
+             (unsigned long)lroundf(ci), lroundf(lo));
+    Serial.println(line);
+  }
+
+  // the outlines went into the canvas and the dynamic state was overwritten
+  restoreMode();
+}
@@ -11,225 +11,349 @@
 #include "src/autonomous.h"
 #include "src/dynamic.h"
 #include "src/shutdown.h"
+#include "src/commands.h"
+#include "src/text.h"
+#include "src/profiler.h"
+#include "src/cpu.h"
+#include "src/latency.h"
+#include "src/drip.h"
+#include "src/message.h"
+#include "src/log.h"
+#include "src/journal.h"
+#include "src/capture.h"
+#include "src/rxstats.h"
+#include "src/clock.h"
+#include "src/settings.h"
+#include "src/mem.h"
+#include "src/mode.h"
+#include "src/pacer.h"
 #include <Arduino.h>
 #ifndef USB_SIM_INPUT
 #define USB_SIM_INPUT 1 //set to 1 for usb debugging, 0 for RIO only
 #endif
 
-// Parse "<mode> <payload>" and run your existing mode logic.
-// 'label' is just for the debug print prefix.
-static void parseAndDispatchLine(char *line, const char *label) {
-  // Debug one clean line
-  Serial.print(label);
-  Serial.println(line);
+// Parse "[#seq] <mode> <payload>" and run your existing mode logic.
+// 'label' is just for the debug print prefix and 'src' the port it came in on;
+// byteUs/lineUs are when the line's first byte and its newline were read
+// (for latency tracing).
+static void parseAndDispatchLine(char *line, const char *label, RxSource src,
+                                 unsigned long byteUs, unsigned long lineUs) {
+  // Debug one clean line (queued; drained after the frame)
+  LOG_INFO_LINE(label, line);
 
-  // Skip leading spaces
+  // Skip leading spaces and the optional sequence token
   char *p = line;
   while (*p == ' ') ++p;
+  p = traceBegin(p, byteUs, lineUs);
 
-  // Parse mode
-  char *endMode = nullptr;
-  long modeVal  = strtol(p, &endMode, 10);
-  if (p == endMode) return;  // no digits -> ignore
-  int8_t newMode = (int8_t)modeVal;
-
-  // Payload begins after spaces following the mode (or nullptr if empty)
-  char *payload = endMode;
-  while (*payload == ' ') ++payload;
-  if (*payload == '\0') payload = nullptr;
-
-  // ---- Your existing mode logic ----
-  if (newMode != currentMode) {
-    lastMode    = currentMode;
-    currentMode = Mode(newMode);
-    audioActive = sponsorLaunched = perryActive = false;
-
-    if (currentMode == MODE_CHECKLIST) {
-      if (payload) processChecklistPayload(payload);
-    } else if (currentMode == MODE_AUTONOMOUS) {
-      initAutonomous();
-    } else if (currentMode == MODE_DYNAMIC) {
-      initDynamic();
-      if (payload) updateDynamicFromPayload(payload);
-    } else if (currentMode == MODE_SHUTDOWN) {
-      // initialise shutdown mode; ignore any payload
-      initShutdown();
-    } else {
-      matrix.fillScreen(0);
-      matrix.show();
-    }
-  } else {
-    if (currentMode == MODE_CHECKLIST && payload) {
-      processChecklistPayload(payload);
-    } else if (currentMode == MODE_DYNAMIC && payload) {
-      updateDynamicFromPayload(payload);
-    }
-    // MODE_AUTONOMOUS and MODE_SHUTDOWN ignore payload updates
+  // '?' lines are diagnostics and never touch the mode
+  if (handleDebugCommand(p, src)) return;
+
+  // Parse mode and payload straight out of the line
+  Message msg;
+  if (!parseMessage(p, msg)) {  // no digits -> ignore
+    rxMalformed++;
+    return;
   }
+  // switch modes or hand the payload to the running one (mode.cpp)
+  modeDispatch(msg);
+  traceApplied();
 }
-// init boot sequence: display boot/mode text, animate options, draw outline, blink led, optional colour test, then draw checklist
-void initBootSequence() {
-  Serial.println("USB serial active");
-  Serial.println("RoboRIO serial active");
-  uint16_t sw = matrix.width(), sh = matrix.height();
-
-  // boot mode splash
-  matrix.fillScreen(0);
-  const char *b1 = "BOOT", *b2 = "MODE";
-  int16_t x1 = (sw - strlen(b1) * CHAR_W) / 2;
-  int16_t x2 = (sw - strlen(b2) * CHAR_W) / 2;
-  matrix.setTextColor(matrix.color565(255, 255, 255));
-  matrix.setCursor(x1, CHAR_H);
-  matrix.print(b1);
-  matrix.setCursor(x2, CHAR_H * 2);
-  matrix.print(b2);
+// ---- boot sequence ----
+// the animation runs one step per loop pass instead of blocking setup(), so the serial
+// readers run from the first pass; a robot message ends it and the requested mode draws
+enum BootPhase : uint8_t {
+  BOOT_SPLASH, BOOT_OPTIONS, BOOT_OUTLINE, BOOT_DASH, BOOT_BLINK,
+  BOOT_COLOR, BOOT_HEADER, BOOT_ITEMS, BOOT_READY, BOOT_DONE
+};
+enum BootEnd : uint8_t { BOOT_END_NONE, BOOT_END_FULL, BOOT_END_FAST, BOOT_END_MESSAGE };
+
+#define BOOT_COLOR_CHUNK 32   // colour test pixels per show
+
+static const char *const bootOpts[] = { "LED", "ROBOT", "USB_d" };
+
+static BootPhase bootPhase = BOOT_DONE;
+static uint16_t  bootStep = 0;          // position within the phase
+static unsigned long bootDue = 0;       // the next step runs once clockMillis() reaches this
+static unsigned long bootPhaseMs = 0;   // dash length and colour fade are timed from here
+static int       dashOffset = 0;        // dash pattern position, carried from dash into blink
+static uint16_t  colorWalk = 0;         // colour test lfsr state; 0 only at the first pixel
+static uint16_t  colorSeed = 1, colorSalt = 0;
+
+static_assert(WIDTH * HEIGHT == 4096, "the colour test walk covers exactly 12 bits of pixels");
+
+static BootEnd   bootEnd = BOOT_END_NONE;
+static unsigned long setupDoneMs = 0, bootEndMs = 0, firstFrameMs = 0;
+static bool      framePending = false;
+
+// bootWait: hold the next step back for ms
+static void bootWait(unsigned long ms) {
+  bootDue = clockMillis() + ms;
+}
+
+// bootNext: move to the first step of another phase
+static void bootNext(BootPhase p) {
+  bootPhase = p;
+  bootStep = 0;
+}
+
+// bootFinish: stop stepping; the next loop pass stamps the first frame
+static void bootFinish(BootEnd how) {
+  bootPhase = BOOT_DONE;
+  bootEnd = how;
+  bootEndMs = clockMillis();
+  framePending = true;
+  memMark(MEM_BOOT);
+}
+
+// typeStep: flash a block cursor and hold it, or replace the cursor with the glyph
+static void typeStep(bool glyph, int16_t x, int16_t y, char c, uint16_t color) {
+  if (!glyph) {
+    matrix.fillRect(x, y, CHAR_W, CHAR_H, color);
+    matrix.show();
+    bootWait(typeDelay);
+    return;
+  }
+  matrix.fillRect(x, y, CHAR_W, CHAR_H, 0);
+  textDrawChar(x, y, c, color);
   matrix.show();
-  delay(bootDelay);
-
-  // type options animation
-  const char *opts[] = { "LED", "ROBOT", "USB_d" };
-  for (uint8_t i = 0; i < 3; i++) {
-    uint8_t L = strlen(opts[i]);
-    int16_t ox = (sw - L * CHAR_W) / 2;
-    int16_t oy = (sh - CHAR_H * 6) / 2 + i * CHAR_H * 2;
-    for (uint8_t j = 0; j < L; j++) {
-      matrix.fillRect(ox + j * CHAR_W, oy, CHAR_W, CHAR_H,
-                      matrix.color565(0, 255, 0));
-      matrix.show();
-      delay(typeDelay);
-      matrix.fillRect(ox + j * CHAR_W, oy, CHAR_W, CHAR_H, 0);
-      matrix.setTextColor(matrix.color565(0, 255, 0));
-      matrix.setCursor(ox + j * CHAR_W, oy);
-      matrix.print(opts[i][j]);
+}
+
+// outline geometry around the first option, shared by the outline, dash and blink phases
+static void ledOutline(int16_t &ox0, int16_t &oy0, int16_t &bx, int16_t &by, int16_t &bw, int16_t &bh) {
+  uint8_t L0 = strlen(bootOpts[0]);
+  ox0 = (matrix.width() - L0 * CHAR_W) / 2;
+  oy0 = (matrix.height() - CHAR_H * 6) / 2;
+  bx = ox0 - 1; by = oy0 - 2;
+  bw = L0 * CHAR_W + 1; bh = CHAR_H + 3;
+}
+
+// bootSequenceStep: run the boot animation's next step if it is due (see header)
+void bootSequenceStep() {
+  if (bootPhase == BOOT_DONE) return;
+  if ((long)(clockMillis() - bootDue) < 0) return;
+  PROFILE_SCOPE("bootStep");
+  int16_t sw = matrix.width(), sh = matrix.height();
+  uint16_t green = matrix.color565(0, 255, 0);
+  uint16_t white = matrix.color565(255, 255, 255);
+  int16_t ox0, oy0, bx, by, bw, bh;
+  ledOutline(ox0, oy0, bx, by, bw, bh);
+  int perim = 2 * (bw + bh) - 4;
+
+  switch (bootPhase) {
+    case BOOT_SPLASH: {
+      // boot mode splash
+      matrix.fillScreen(0);
+      const char *b1 = "BOOT", *b2 = "MODE";
+      textDrawLabel((sw - strlen(b1) * CHAR_W) / 2, CHAR_H, b1, white);
+      textDrawLabel((sw - strlen(b2) * CHAR_W) / 2, CHAR_H * 2, b2, white);
       matrix.show();
+      bootWait(bootDelay);
+      bootNext(BOOT_OPTIONS);
+      break;
     }
-  }
-  delay(postOptionsDelay);
 
-  // progressive outline draw
-  uint8_t L0 = strlen(opts[0]);
-  int16_t ox0 = (sw - L0 * CHAR_W) / 2, oy0 = (sh - CHAR_H * 6) / 2;
-  int16_t bx = ox0 - 1, by = oy0 - 2;
-  int16_t bw = L0 * CHAR_W + 1, bh = CHAR_H + 3;
-  uint16_t green = matrix.color565(0, 255, 0);
-  int hLen = bw - 1, vLen = bh - 1, steps = hLen + vLen,
-      delayStep = 350 / steps;
-  matrix.drawPixel(bx, by, green);
-  matrix.show();
-  delay(delayStep);
-  for (int s = 1; s <= steps; s++) {
-    if (s <= hLen) matrix.drawPixel(bx + s, by, green);
-    else matrix.drawPixel(bx + bw - 1, by + (s - hLen), green);
-    if (s <= vLen) matrix.drawPixel(bx, by + s, green);
-    else matrix.drawPixel(bx + (s - vLen), by + bh - 1, green);
-    matrix.show();
-    delay(delayStep);
-  }
-  delay(dashDelayBefore);
-  int perim = 2 * (bw + bh) - 4, offset = 0;
-  unsigned long dashStart = millis();
-  while (millis() - dashStart < dashedPhaseDuration) {
-    matrix.drawRect(bx, by, bw, bh, 0);
-    drawDashedOutline(bx, by, bw, bh, perim, offset, green);
-    matrix.show();
-    delay(flashDelay);
-    offset = (offset + 1) % perim;
-  }
+    case BOOT_OPTIONS: {
+      // type options animation: cursor then glyph, one per step
+      uint8_t i = 0, j = bootStep / 2;
+      while (j >= strlen(bootOpts[i])) j -= strlen(bootOpts[i++]);
+      uint8_t L = strlen(bootOpts[i]);
+      int16_t ox = (sw - L * CHAR_W) / 2;
+      int16_t oy = (sh - CHAR_H * 6) / 2 + i * CHAR_H * 2;
+      bool glyph = bootStep++ & 1;
+      typeStep(glyph, ox + j * CHAR_W, oy, bootOpts[i][j], green);
+      if (glyph && i == 2 && j == L - 1) {
+        bootWait(postOptionsDelay);
+        bootNext(BOOT_OUTLINE);
+      }
+      break;
+    }
 
-  // blink "LED"
-  for (uint8_t f = 0; f < flashCount; f++) {
-    matrix.fillRect(ox0, oy0, bw, CHAR_H, 0);
-    offset = (offset + 1) % perim;
-    matrix.drawRect(bx, by, bw, bh, 0);
-    drawDashedOutline(bx, by, bw, bh, perim, offset, green);
-    matrix.show();
-    delay(flashDelay);
-    matrix.setTextColor(green);
-    matrix.setCursor(ox0, oy0);
-    matrix.print(opts[0]);
-    offset = (offset + 1) % perim;
-    matrix.drawRect(bx, by, bw, bh, 0);
-    drawDashedOutline(bx, by, bw, bh, perim, offset, green);
-    matrix.show();
-    delay(flashDelay);
-  }
+    case BOOT_OUTLINE: {
+      // progressive outline draw
+      int hLen = bw - 1, vLen = bh - 1, steps = hLen + vLen,
+          delayStep = 350 / steps;
+      int s = bootStep++;
+      if (s == 0) {
+        matrix.drawPixel(bx, by, green);
+      } else {
+        if (s <= hLen) matrix.drawPixel(bx + s, by, green);
+        else matrix.drawPixel(bx + bw - 1, by + (s - hLen), green);
+        if (s <= vLen) matrix.drawPixel(bx, by + s, green);
+        else matrix.drawPixel(bx + (s - vLen), by + bh - 1, green);
+      }
+      matrix.show();
+      bootWait(delayStep);
+      if (s == steps) {
+        bootWait(delayStep + dashDelayBefore);
+        dashOffset = 0;
+        bootNext(BOOT_DASH);
+      }
+      break;
+    }
 
-  // color test (commented out block)
-  
-  {
-    const char *c1="COLOR", *c2="TEST";
-    int16_t cx1=(sw-strlen(c1)*CHAR_W)/2, cy1=sh/2-CHAR_H,
-            cx2=(sw-strlen(c2)*CHAR_W)/2, cy2=sh/2;
-    for (uint8_t p=0; p<3; p++){
-      uint8_t pr=(p==0)*255, pg=(p==1)*255, pb=(p==2)*255;
-      uint8_t invR=255-pr, invG=255-pg, invB=255-pb;
-      unsigned long start=millis();
-      uint16_t total=sw*sh;
-      uint16_t *coords=new uint16_t[total];
-      for (uint16_t i=0;i<total;i++) coords[i]=i;
-      shuffleArray(coords,total);
-      for (uint16_t i=0;i<total;i++){
-        matrix.drawPixel(coords[i]%sw,coords[i]/sw,
-                         matrix.color565(pr,pg,pb));
-        if ((i&0x1F)==0){
-          float t=float(millis()-start)/float(hueCycleDuration);
-          if (t>1.0) t=1.0;
-          uint8_t tr=uint8_t(255+(invR-255)*t),
-                  tg=uint8_t(255+(invG-255)*t),
-                  tb=uint8_t(255+(invB-255)*t);
-          matrix.setTextColor(matrix.color565(tr,tg,tb));
-          matrix.setCursor(cx1,cy1); matrix.print(c1);
-          matrix.setCursor(cx2,cy2); matrix.print(c2);
-          matrix.show();
-        }
+    case BOOT_DASH:
+      if (bootStep++ == 0) bootPhaseMs = clockMillis();
+      if (clockMillis() - bootPhaseMs >= dashedPhaseDuration) {
+        bootNext(BOOT_BLINK);
+        break;
+      }
+      matrix.drawRect(bx, by, bw, bh, 0);
+      drawDashedOutline(bx, by, bw, bh, perim, dashOffset, green);
+      matrix.show();
+      bootWait(flashDelay);
+      dashOffset = (dashOffset + 1) % perim;
+      break;
+
+    case BOOT_BLINK:
+      // blink "LED": even steps blank it, odd steps redraw it; the dashes march either way
+      if ((bootStep & 1) == 0) matrix.fillRect(ox0, oy0, bw, CHAR_H, 0);
+      else textDrawLabel(ox0, oy0, bootOpts[0], green);
+      dashOffset = (dashOffset + 1) % perim;
+      matrix.drawRect(bx, by, bw, bh, 0);
+      drawDashedOutline(bx, by, bw, bh, perim, dashOffset, green);
+      matrix.show();
+      bootWait(flashDelay);
+      if (++bootStep == 2 * flashCount) bootNext(BOOT_COLOR);
+      break;
+
+    case BOOT_COLOR: {
+      // color test: per pass, scatter the primary in and back out, BOOT_COLOR_CHUNK pixels per show.
+      // the order is an lfsr walk xored with a random salt, so no coordinate table is needed
+      const char *c1 = "COLOR", *c2 = "TEST";
+      uint16_t total = sw * sh, chunks = total / BOOT_COLOR_CHUNK;
+      uint8_t p = bootStep / (2 * chunks);
+      bool clearing = (bootStep / chunks) & 1;
+      uint16_t chunk = bootStep % chunks;
+      if (chunk == 0) {
+        colorWalk = 0;
+        colorSeed = random(1, total);
+        colorSalt = random(0, total);
+        if (!clearing) bootPhaseMs = clockMillis();
       }
-      shuffleArray(coords,total);
-      for (uint16_t i=0;i<total;i++){
-        matrix.drawPixel(coords[i]%sw,coords[i]/sw,0);
-        if ((i&0x1F)==0) matrix.show();
+      uint8_t pr = (p == 0) * 255, pg = (p == 1) * 255, pb = (p == 2) * 255;
+      uint16_t pc = clearing ? 0 : matrix.color565(pr, pg, pb);
+      for (uint8_t i = 0; i < BOOT_COLOR_CHUNK; i++) {
+        uint16_t px = colorWalk ^ colorSalt;
+        matrix.drawPixel(px % sw, px / sw, pc);
+        colorWalk = colorWalk ? lfsr12(colorWalk) : colorSeed;
       }
-      delete[] coords;
+      if (!clearing) {
+        float t = float(clockMillis() - bootPhaseMs) / float(hueCycleDuration);
+        if (t > 1.0) t = 1.0;
+        uint8_t tr = uint8_t(255 + ((255 - pr) - 255) * t),
+                tg = uint8_t(255 + ((255 - pg) - 255) * t),
+                tb = uint8_t(255 + ((255 - pb) - 255) * t);
+        uint16_t tc = matrix.color565(tr, tg, tb);
+        textDrawLabel((sw - strlen(c1) * CHAR_W) / 2, sh / 2 - CHAR_H, c1, tc);
+        textDrawLabel((sw - strlen(c2) * CHAR_W) / 2, sh / 2, c2, tc);
+      }
+      matrix.show();
+      if (++bootStep == 6 * chunks) bootNext(BOOT_HEADER);
+      break;
     }
-  }
-  
-
-  // checklist phase write-on
-  matrix.fillScreen(0);
-  delay(100);
-  matrix.setTextColor(matrix.color565(255, 255, 255));
-  matrix.setCursor((sw - 5 * CHAR_W) / 2, topSpacing);
-  matrix.print("MATCH");
-  matrix.setCursor((sw - 5 * CHAR_W) / 2, topSpacing + CHAR_H);
-  matrix.print("SETUP");
-  matrix.show();
-  delay(1000);
-  for (uint8_t i = 0; i < numChecklist; i++) {
-    const char *L = checklistItems[i];
-    int16_t ln = strlen(L);
-    int16_t ty = topSpacing + CHAR_H + betweenSetupAndPiece + pieceYOffset
-                 + i * (CHAR_H * 2 + textBoxGap + itemGap);
-    int16_t lx = (sw - ln * CHAR_W) / 2;
-    for (uint8_t j = 0; j < ln; j++) {
-      int16_t cx = lx + j * CHAR_W;
-      matrix.fillRect(cx, ty, CHAR_W, CHAR_H,
-                      matrix.color565(255, 255, 255));
+
+    case BOOT_HEADER:
+      // checklist phase write-on
+      if (bootStep++ == 0) {
+        matrix.fillScreen(0);
+        bootWait(100);
+        break;
+      }
+      textDrawLabel((sw - 5 * CHAR_W) / 2, topSpacing, "MATCH", white);
+      textDrawLabel((sw - 5 * CHAR_W) / 2, topSpacing + CHAR_H, "SETUP", white);
       matrix.show();
-      delay(typeDelay);
-      matrix.fillRect(cx, ty, CHAR_W, CHAR_H, 0);
-      matrix.setTextColor(matrix.color565(255, 255, 255));
-      matrix.setCursor(cx, ty);
-      matrix.print(L[j]);
+      bootWait(1000);
+      bootNext(BOOT_ITEMS);
+      break;
+
+    case BOOT_ITEMS: {
+      // each item types its label a glyph half per step, then sweeps its box a column per step
+      uint8_t i = 0;
+      uint16_t k = bootStep;
+      while (k >= 2 * strlen(checklistItems[i]) + chkBoxW) k -= 2 * strlen(checklistItems[i++]) + chkBoxW;
+      const char *L = checklistItems[i];
+      int16_t ln = strlen(L);
+      bootStep++;
+      if (k < 2 * ln) {
+        int16_t ty = topSpacing + CHAR_H + betweenSetupAndPiece + pieceYOffset
+                     + i * (CHAR_H * 2 + textBoxGap + itemGap);
+        int16_t lx = (sw - ln * CHAR_W) / 2;
+        typeStep(k & 1, lx + (k / 2) * CHAR_W, ty, L[k / 2], white);
+        break;
+      }
+      drawBoxColumn(i, k - 2 * ln, matrix.color565(255, 0, 0));
       matrix.show();
+      bootWait(boxDelay / chkBoxW);
+      if (i == numChecklist - 1 && k - 2 * ln == chkBoxW - 1) {
+        bootWait(postChecklistDelay);
+        bootNext(BOOT_READY);
+      }
+      break;
     }
-    sweepBoxLR(i, matrix.color565(255, 0, 0));
+
+    case BOOT_READY:
+      textDrawLabel((sw - 3 * CHAR_W) / 2, sh - CHAR_H * 2, "NOT", matrix.color565(255, 0, 0));
+      textDrawLabel((sw - 5 * CHAR_W) / 2, sh - CHAR_H, "READY", matrix.color565(255, 0, 0));
+      matrix.show();
+      bootFinish(BOOT_END_FULL);
+      break;
+
+    default:
+      break;
   }
-  delay(postChecklistDelay);
-  matrix.setTextColor(matrix.color565(255, 0, 0));
-  matrix.setCursor((sw - 3 * CHAR_W) / 2, sh - CHAR_H * 2);
-  matrix.print("NOT");
-  matrix.setCursor((sw - 5 * CHAR_W) / 2, sh - CHAR_H);
-  matrix.print("READY");
-  matrix.show();
+}
+
+// init boot sequence: start the animation, or with the fast boot flag draw the checklist at once
+void initBootSequence() {
+  Serial.println("USB serial active");
+  Serial.println("RoboRIO serial active");
+  setupDoneMs = clockMillis();
+  if (settings.fastBoot) {
+    drawChecklistStatic();
+    bootFinish(BOOT_END_FAST);
+    return;
+  }
+  bootDue = clockMillis();
+  bootNext(BOOT_SPLASH);
+  bootSequenceStep();
+}
+
+// bootSequenceSkip: a robot message arrived; drop the rest of the animation (see header)
+void bootSequenceSkip(int8_t mode) {
+  if (bootPhase == BOOT_DONE) return;
+  bootFinish(BOOT_END_MESSAGE);
+  // the other modes draw their own first frame; checklist updates animate over the static screen
+  if (mode == MODE_CHECKLIST) drawChecklistStatic();
+}
+
+bool bootRunning() {
+  return bootPhase != BOOT_DONE;
+}
+
+// bootNoteFrame: stamp the first frame once the boot is over
+void bootNoteFrame() {
+  if (!framePending) return;
+  framePending = false;
+  firstFrameMs = clockMillis();
+  LOG_INFO("boot: first frame %lu ms after reset", firstFrameMs);
+}
+
+// bootReport: flag, how the last boot ended and its timing
+void bootReport() {
+  static const char *const ends[] = { "running", "full", "fast", "message" };
+  char line[96];
+  snprintf(line, sizeof(line), "boot: fast flag %s, this boot %s",
+           settings.fastBoot ? "on" : "off", ends[bootEnd]);
+  Serial.println(line);
+  if (bootPhase != BOOT_DONE) {
+    snprintf(line, sizeof(line), "  setup done %lu ms, phase %u step %u",
+             setupDoneMs, (unsigned)bootPhase, (unsigned)bootStep);
+  } else {
+    snprintf(line, sizeof(line), "  setup done %lu ms, boot ended %lu ms, first frame %lu ms after reset",
+             setupDoneMs, bootEndMs, firstFrameMs);
+  }
+  Serial.println(line);
 }
 
 // run boot sequence: process serial updates and manage audio/sponsor/perry based on readiness
@@ -264,8 +388,8 @@ void runBootSequence() {
   if (gReadyState && !sponsorLaunched) {
     // wait 10s after ready to launch sponsor scroller
     if (readyTimestamp == 0) {
-      readyTimestamp = millis();
-    } else if (millis() - readyTimestamp >= 10000UL) {
+      readyTimestamp = clockMillis();
+    } else if (clockMillis() - readyTimestamp >= 10000UL) {
       sponsorLaunched = true;
       initSponsorScroller();
     }
@@ -285,25 +409,25 @@ void runBootSequence() {
       writeEncryptedText4();
 
     } else if (!p_decrypting) {
-      if (millis() >= p_startObf + ODUR) {
+      if (clockMillis() >= p_startObf + ODUR) {
         p_decrypting = true;
-        p_lastUpdate = millis();
-      } else if (millis() - p_lastObf > OSPD) {
+        p_lastUpdate = clockMillis();
+      } else if (clockMillis() - p_lastObf > OSPD) {
         displayRandomText4();
-        p_lastObf = millis();
+        p_lastObf = clockMillis();
       }
 
     } else if (p_linesDone < perryLineCount4) {
       // continue decryption animation
-      if (millis() - p_lastUpdate > ADEL) {
+      if (clockMillis() - p_lastUpdate > ADEL) {
         updateDecryption4();
       }
 
     } else {
       // all lines decrypted: hold full text for 2s, then start audio‐vis
       if (p_finalHold == 0) {
-        p_finalHold = millis();
-      } else if (millis() - p_finalHold >= 3000UL) {
+        p_finalHold = clockMillis();
+      } else if (clockMillis() - p_finalHold >= 3000UL) {
         if (!audioActive) {
           perryActive = false;
           audioActive = true;
@@ -314,176 +438,196 @@ void runBootSequence() {
   }
 }
 
+// line assembly per source, shared by the drip and first-in/first-out readers below so a
+// line that is half read when dripFeedMode changes carries on in the other reader
+static char          rxBuf[64];  // Adjust if you add more fields
+static size_t        rxFill = 0;
+static unsigned long rxByteUs = 0;
+static bool          rxOverflow = false;
+static DripQueue     rxQueue;
+#if USB_SIM_INPUT
+static char          usbBuf[64];
+static size_t        usbFill = 0;
+static unsigned long usbByteUs = 0;
+static bool          usbOverflow = false;
+static DripQueue     usbQueue;
+#endif
+
+// robotInputFlush: drop the lines queued for the drip feed; run when dripFeedMode changes so
+// they are neither stranded nor dispatched late (stale mode switches included) when it is
+// turned back on
+void robotInputFlush() {
+  rxQueue.head = rxQueue.count = 0;
+#if USB_SIM_INPUT
+  usbQueue.head = usbQueue.count = 0;
+#endif
+}
+
 // handle robot message: consolidate and dispatch serial/usb messages (see header)
 void handleRobotMessage() {
-  // When dripFeedMode is enabled, consolidate multiple incoming
-  // messages into the latest complete line.  Otherwise run the
-  // original first‑in/first‑out behaviour.  Keeping the original code
-  // intact allows toggling this feature off if desired.
+  PROFILE_SCOPE("handleRobotMessage");
+  // When dripFeedMode is enabled, complete lines are queued per source
+  // and drained a few per call.  While rendering is slow, redundant
+  // level updates collapse into the newest one, but mode transitions
+  // and edge events (intake, score, climb, all-green) are never merged
+  // or dropped; each one ends the call so it gets its own frame.
+  // Otherwise run the original first‑in/first‑out behaviour.  Keeping
+  // the original code intact allows toggling this feature off if desired.
   if (dripFeedMode) {
-    // Buffers for Serial1 and optional USB simulation.  These mirror
-    // the original static buffers to preserve capacity across calls.
-    static char    rxBuf[64];
-    static size_t  fill = 0;
+    bool coalesce = dripNoteLoad(pacerFrameCost());
+    DripLine line;
+    uint8_t budget;
 #if USB_SIM_INPUT
-    static char    usbBuf[64];
-    static size_t  ufill = 0;
-    bool           usbGot = false;
-    char           usbLast[64];
-    // Consolidate all available lines on USB Serial into the last
-    // complete message.  Only the most recent newline‑terminated line
-    // will be dispatched below.
     while (Serial.available()) {
       int b = Serial.read();
       if (b < 0) break;
       char c = (char)b;
+      rxByte(RX_USB);
       if (c == '\r') continue;
       if (c != '\n') {
-        if (ufill < sizeof(usbBuf) - 1) usbBuf[ufill++] = c;
+        if (usbFill == 0) usbByteUs = micros();
+        if (usbFill < sizeof(usbBuf) - 1) usbBuf[usbFill++] = c;
+        else rxOverflowByte(RX_USB, usbOverflow);
         continue;
       }
       // newline encountered
-      usbBuf[ufill] = '\0';
-      ufill = 0;
+      usbBuf[usbFill] = '\0';
+      usbFill = 0;
+      rxLineEnd(RX_USB, usbOverflow);
       if (usbBuf[0] != '\0') {
-        strncpy(usbLast, usbBuf, sizeof(usbLast));
-        usbLast[sizeof(usbLast)-1] = '\0';
-        usbGot = true;
+        // a full queue hands its oldest line over now rather than losing one
+        if (dripFull(usbQueue) && dripTake(usbQueue, line)) {
+          parseAndDispatchLine(line.text, "USB SIM (drip) -> ", RX_USB, line.byteUs, line.lineUs);
+        }
+        uint32_t merged = usbQueue.coalesced;
+        dripPush(usbQueue, usbBuf, usbByteUs, micros(), coalesce);
+        if (usbQueue.coalesced != merged) {
+          rxStats[RX_USB].coalesced++;
+          journalEvent(JEV_DROP, 0, JDROP_COALESCED);
+        }
       }
     }
 #endif
-    // Consolidate Serial1 messages in the same fashion
-    bool serialGot = false;
-    char lastRx[64];
-    while (Serial1.available()) {
-      int b = Serial1.read();
+    // Queue Serial1 messages in the same fashion (a trace replay stands in for Serial1)
+    Stream &rio = robotInput();
+    while (rio.available()) {
+      int b = rio.read();
       if (b < 0) break;
       char c = (char)b;
+      rxByte(RX_SERIAL1);
       if (c == '\r') continue;
       if (c != '\n') {
-        if (fill < sizeof(rxBuf) - 1) {
-          rxBuf[fill++] = c;
-        } else {
+        if (rxFill == 0) rxByteUs = micros();
+        if (rxFill < sizeof(rxBuf) - 1) {
+          rxBuf[rxFill++] = c;
+        } else if (rxOverflowByte(RX_SERIAL1, rxOverflow)) {
           // overflow: ignore until newline
+          journalEvent(JEV_DROP, 1, JDROP_OVERFLOW);
         }
         continue;
       }
-      // newline terminator: capture latest non‑blank line
-      rxBuf[fill] = '\0';
-      fill = 0;
+      // newline terminator: queue the non‑blank line
+      rxBuf[rxFill] = '\0';
+      rxFill = 0;
+      rxLineEnd(RX_SERIAL1, rxOverflow);
       if (rxBuf[0] != '\0') {
-        strncpy(lastRx, rxBuf, sizeof(lastRx));
-        lastRx[sizeof(lastRx)-1] = '\0';
-        serialGot = true;
+        captureLine(rxBuf);
+        if (dripFull(rxQueue) && dripTake(rxQueue, line)) {
+          parseAndDispatchLine(line.text, "Serial1 (drip) -> ", RX_SERIAL1, line.byteUs, line.lineUs);
+        }
+        uint32_t merged = rxQueue.coalesced;
+        dripPush(rxQueue, rxBuf, rxByteUs, micros(), coalesce);
+        if (rxQueue.coalesced != merged) {
+          rxStats[RX_SERIAL1].coalesced++;
+          journalEvent(JEV_DROP, 1, JDROP_COALESCED);
+        }
       }
     }
-    // Dispatch the latest USB simulation line first (if any); this
-    // mirrors the original order of handling USB before Serial1.  Then
-    // dispatch the latest Serial1 line.  Only one line from each
-    // source is processed per call, eliminating backlog.
+    // Dispatch USB simulation lines first; this mirrors the original
+    // order of handling USB before Serial1.  Then dispatch Serial1.
 #if USB_SIM_INPUT
-    if (usbGot) {
-      parseAndDispatchLine(usbLast, "USB SIM (drip) -> ");
+    budget = dripBudget();
+    while (dripPop(usbQueue, line, budget)) {
+      parseAndDispatchLine(line.text, "USB SIM (drip) -> ", RX_USB, line.byteUs, line.lineUs);
     }
 #endif
-    if (serialGot) {
-      parseAndDispatchLine(lastRx, "Serial1 (drip) -> ");
+    budget = dripBudget();
+    while (dripPop(rxQueue, line, budget)) {
+      parseAndDispatchLine(line.text, "Serial1 (drip) -> ", RX_SERIAL1, line.byteUs, line.lineUs);
     }
   } else {
     // Serial1-only, line-safe reader/dispatcher
-    static char rxBuf[64];  // Adjust if you add more fields
-    static size_t fill = 0;
-
 #if USB_SIM_INPUT
     // --- USB simulation (type: "0 1,1,0,1" + Enter in Serial Monitor) ---
-    static char    usbBuf[64];
-    static size_t  ufill = 0;
-
     while (Serial.available()) {
       int b = Serial.read();
       if (b < 0) break;
       char c = (char)b;
+      rxByte(RX_USB);
 
       if (c == '\r') continue;             // ignore CR
       if (c != '\n') {
-        if (ufill < sizeof(usbBuf) - 1) usbBuf[ufill++] = c;
+        if (usbFill == 0) usbByteUs = micros();
+        if (usbFill < sizeof(usbBuf) - 1) usbBuf[usbFill++] = c;
+        else rxOverflowByte(RX_USB, usbOverflow);
         continue;                          // accumulate until newline
       }
 
       // newline -> terminate and dispatch
-      usbBuf[ufill] = '\0';
-      ufill = 0;
+      usbBuf[usbFill] = '\0';
+      usbFill = 0;
+      rxLineEnd(RX_USB, usbOverflow);
       if (usbBuf[0] != '\0') {
-        parseAndDispatchLine(usbBuf, "USB SIM -> ");
+        parseAndDispatchLine(usbBuf, "USB SIM -> ", RX_USB, usbByteUs, micros());
       }
     }
 #endif
 
-    while (Serial1.available()) {
-      int b = Serial1.read();
+    Stream &rio = robotInput();
+    while (rio.available()) {
+      int b = rio.read();
       if (b < 0) break;
       char c = (char)b;
+      rxByte(RX_SERIAL1);
 
       if (c == '\r') continue;  // ignore CR; trigger on LF
       if (c != '\n') {
-        if (fill < sizeof(rxBuf) - 1) {
-          rxBuf[fill++] = c;
-        } else {
+        if (rxFill == 0) rxByteUs = micros();
+        if (rxFill < sizeof(rxBuf) - 1) {
+          rxBuf[rxFill++] = c;
+        } else if (rxOverflowByte(RX_SERIAL1, rxOverflow)) {
           // overflow: drop until newline
+          journalEvent(JEV_DROP, 1, JDROP_OVERFLOW);
         }
         continue;
       }
 
       // newline -> terminate current line
-      rxBuf[fill] = '\0';
-      fill = 0;
+      rxBuf[rxFill] = '\0';
+      rxFill = 0;
+      rxLineEnd(RX_SERIAL1, rxOverflow);
+      unsigned long lineUs = micros();
 
       if (rxBuf[0] == '\0') continue;  // blank line, ignore
+      captureLine(rxBuf);
 
       // Debug print of exactly one full line from Serial1
-      Serial.print("Msg from Serial1: ");
-      Serial.println(rxBuf);
+      LOG_INFO_LINE("Msg from Serial1: ", rxBuf);
 
-      // ---- Parse "<mode> <payload>" ----
+      // ---- Parse "[#seq] <mode> <payload>" ----
       char *p = rxBuf;
       while (*p == ' ') ++p;
+      p = traceBegin(p, rxByteUs, lineUs);
+      if (handleDebugCommand(p, RX_SERIAL1)) continue;
 
-      char *endMode = nullptr;
-      long modeVal = strtol(p, &endMode, 10);
-      if (p == endMode) continue;  // no digits parsed -> malformed
-
-      int8_t newMode = (int8_t)modeVal;
-
-      // Skip spaces; payload is remainder (or nullptr if none)
-      char *payload = endMode;
-      while (*payload == ' ') ++payload;
-      if (*payload == '\0') payload = nullptr;
-
-      // ---- Mode switch / update (your original logic) ----
-      if (newMode != currentMode) {
-        lastMode = currentMode;
-        currentMode = Mode(newMode);
-        audioActive = sponsorLaunched = perryActive = false;
-
-        if (currentMode == MODE_CHECKLIST) {
-          if (payload) processChecklistPayload(payload);
-        } else if (currentMode == MODE_AUTONOMOUS) {
-          initAutonomous();
-        } else if (currentMode == MODE_DYNAMIC) {
-          initDynamic();
-          if (payload) updateDynamicFromPayload(payload);
-        } else {
-          matrix.fillScreen(0);
-          matrix.show();
-        }
-      } else {
-        if (currentMode == MODE_CHECKLIST && payload) {
-          processChecklistPayload(payload);
-        } else if (currentMode == MODE_DYNAMIC && payload) {
-          updateDynamicFromPayload(payload);
-        }
-        // autonomous ignores payload updates
+      Message msg;
+      if (!parseMessage(p, msg)) {  // no digits parsed -> malformed
+        rxMalformed++;
+        continue;
       }
+      // ---- Mode switch / update (shared with the drip path) ----
+      modeDispatch(msg);
+      traceApplied();
     }
   }
 }
@@ -0,0 +1,167 @@
+// © 2025 SC5K Systems
+
+#include "src/capture.h"
+#include "src/clock.h"
+#include "src/matrix_config.h"
+#include <Arduino.h>
+#include <string.h>
+#include <stdio.h>
+
+// buffer records: 4-byte ms offset, 1-byte length, then the text without its newline
+#define CAPTURE_HEADER 5
+
+static uint8_t  buffer[CAPTURE_BYTES];
+static uint16_t used = 0;
+static bool     recording = false;
+static bool     truncated = false;     // a line didn't fit and recording stopped
+static unsigned long recordBase = 0;
+
+static bool     replaying = false;
+static bool     finished = false;
+static unsigned long replayBase = 0;
+static unsigned long lastFedMs = 0;    // replay clock when the last record was fully read
+static uint16_t pos = 0;               // record being fed
+static uint8_t  idx = 0;               // next byte of it; len = the newline
+static uint32_t frames = 0;
+
+static uint32_t recordMs(uint16_t at) {
+  uint32_t ms;
+  memcpy(&ms, buffer + at, sizeof(ms));
+  return ms;
+}
+
+static bool append(uint32_t ms, const char *line, size_t n) {
+  if (n > 255) n = 255;
+  if (used + CAPTURE_HEADER + n > CAPTURE_BYTES) return false;
+  memcpy(buffer + used, &ms, sizeof(ms));
+  buffer[used + 4] = (uint8_t)n;
+  memcpy(buffer + used + CAPTURE_HEADER, line, n);
+  used += CAPTURE_HEADER + n;
+  return true;
+}
+
+void captureStart() {
+  used = 0;
+  truncated = false;
+  recording = true;
+  recordBase = clockMillis();
+}
+
+void captureStop() {
+  recording = false;
+}
+
+void captureLine(const char *line) {
+  if (!recording || replaying) return;
+  if (!append(clockMillis() - recordBase, line, strlen(line))) {
+    truncated = true;
+    recording = false;
+  }
+}
+
+void captureDump() {
+  char head[16];
+  for (uint16_t at = 0; at < used; at += CAPTURE_HEADER + buffer[at + 4]) {
+    snprintf(head, sizeof(head), "%lu ", (unsigned long)recordMs(at));
+    Serial.print(head);
+    Serial.write(buffer + at + CAPTURE_HEADER, buffer[at + 4]);
+    Serial.println();
+  }
+}
+
+void replayStart() {
+  recording = false;
+  replaying = used > 0;
+  finished = !replaying;
+  replayBase = clockMillis();
+  lastFedMs = 0;
+  pos = 0;
+  idx = 0;
+  frames = 0;
+}
+
+// checkEnd: once every record is in and the tail has run, print the summary
+static void checkEnd() {
+  if (!replaying || pos < used) return;
+  if (clockMillis() - replayBase - lastFedMs < REPLAY_TAIL_MS) return;
+  replaying = false;
+  finished = true;
+  Serial.print("replay done: ");
+  Serial.print(frames);
+  Serial.println(" frames");
+}
+
+// ReplayStream: hands out the bytes of every record whose time has come, newline included
+class ReplayStream : public Stream {
+ public:
+  int available() override {
+    checkEnd();
+    if (!replaying || pos >= used) return 0;
+    if (clockMillis() - replayBase < recordMs(pos)) return 0;
+    return buffer[pos + 4] + 1 - idx;
+  }
+  int read() override {
+    int c = peek();
+    if (c < 0) return c;
+    if (++idx > buffer[pos + 4]) {
+      pos += CAPTURE_HEADER + buffer[pos + 4];
+      idx = 0;
+      lastFedMs = clockMillis() - replayBase;
+    }
+    return c;
+  }
+  int peek() override {
+    if (!available()) return -1;
+    return idx < buffer[pos + 4] ? buffer[pos + CAPTURE_HEADER + idx] : '\n';
+  }
+  // answers meant for the RoboRIO (trace echoes) go nowhere during a replay
+  size_t write(uint8_t) override {
+    return 1;
+  }
+  int availableForWrite() override {
+    return CAPTURE_BYTES;
+  }
+};
+
+static ReplayStream replayStream;
+
+Stream &robotInput() {
+  if (replaying) return replayStream;
+  return Serial1;
+}
+
+void replayFrame() {
+  if (!replaying) return;
+  frames++;
+  checkEnd();
+}
+
+void captureFrameDump(const uint16_t *pixels, uint16_t w, uint16_t h, uint32_t frame) {
+  char cell[16];
+  for (uint16_t y = 0; y < h; y++) {
+    snprintf(cell, sizeof(cell), "P %lu %u ", (unsigned long)frame, y);
+    Serial.print(cell);
+    for (uint16_t x = 0; x < w; x++) {
+      snprintf(cell, sizeof(cell), "%04x", pixels[y * w + x]);
+      Serial.print(cell);
+    }
+    Serial.println();
+  }
+}
+
+void captureReport() {
+  uint16_t lines = 0;
+  for (uint16_t at = 0; at < used; at += CAPTURE_HEADER + buffer[at + 4]) lines++;
+  Serial.print(recording ? "recording, " : replaying ? "replaying, " : "idle, ");
+  Serial.print(lines);
+  Serial.print(" lines, ");
+  Serial.print(used);
+  Serial.print("/");
+  Serial.print(CAPTURE_BYTES);
+  Serial.println(truncated ? " bytes (full, later lines lost)" : " bytes");
+  if (replaying || finished) {
+    Serial.print("  replay: ");
+    Serial.print(frames);
+    Serial.println(" frames shown");
+  }
+}
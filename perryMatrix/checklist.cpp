@@ -4,6 +4,13 @@
 #include "src/matrix_config.h"
 #include "src/globals.h"
 #include "src/helpers.h"
+#include "src/sprite.h"
+#include "src/sprite_assets.h"
+#include "src/text.h"
+#include "src/cpu.h"
+#include "src/log.h"
+#include "src/journal.h"
+#include "src/rxstats.h"
 #include <Arduino.h>
 #include <string.h>
 
@@ -29,42 +36,41 @@ void drawDashedOutline(int bx, int by, int bw, int bh,
   }
 }
 
-// sweep box left→right: animate vertical fill of a checklist box
-void sweepBoxLR(uint8_t idx, uint16_t color) {
+// draw box column: one vertical line of a checklist box, the unit of both sweeps
+void drawBoxColumn(uint8_t idx, uint8_t col, uint16_t color) {
   uint16_t sw = matrix.width();
   int16_t lx = (sw - chkBoxW)/2;
   int16_t ly = topSpacing + CHAR_H + betweenSetupAndPiece + pieceYOffset
                + idx*(CHAR_H + textBoxGap + chkBoxH + itemGap);
+  matrix.drawFastVLine(lx + col, ly + CHAR_H + textBoxGap, chkBoxH, color);
+}
+
+// sweep box left→right: animate vertical fill of a checklist box
+void sweepBoxLR(uint8_t idx, uint16_t color) {
   for (uint8_t c = 0; c < chkBoxW; c++) {
-    matrix.drawFastVLine(lx + c, ly + CHAR_H + textBoxGap, chkBoxH, color);
+    drawBoxColumn(idx, c, color);
     matrix.show();
-    delay(boxDelay / chkBoxW);
+    cpuDelay(boxDelay / chkBoxW);
   }
 }
 
 // sweep box right→left: animate vertical fill of a checklist box
 void sweepBoxRL(uint8_t idx, uint16_t color) {
-  uint16_t sw = matrix.width();
-  int16_t lx = (sw - chkBoxW)/2;
-  int16_t ly = topSpacing + CHAR_H + betweenSetupAndPiece + pieceYOffset
-               + idx*(CHAR_H + textBoxGap + chkBoxH + itemGap);
   for (int16_t c = chkBoxW - 1; c >= 0; c--) {
-    matrix.drawFastVLine(lx + c, ly + CHAR_H + textBoxGap, chkBoxH, color);
+    drawBoxColumn(idx, c, color);
     matrix.show();
-    delay(boxDelay / chkBoxW);
+    cpuDelay(boxDelay / chkBoxW);
   }
 }
 
 // draw static checklist: header, items with coloured boxes, and not ready text
 void drawChecklistStatic() {
   matrix.fillScreen(0);
-  matrix.setTextColor(matrix.color565(255,255,255));
+  uint16_t white = matrix.color565(255,255,255);
 
   // header
-  matrix.setCursor((matrix.width() - 5*CHAR_W)/2, topSpacing);
-  matrix.print("MATCH");
-  matrix.setCursor((matrix.width() - 5*CHAR_W)/2, topSpacing + CHAR_H);
-  matrix.print("SETUP");
+  textDrawLabel((matrix.width() - 5*CHAR_W)/2, topSpacing, "MATCH", white);
+  textDrawLabel((matrix.width() - 5*CHAR_W)/2, topSpacing + CHAR_H, "SETUP", white);
 
   // items + boxes
   for (uint8_t i = 0; i < numChecklist; i++) {
@@ -73,45 +79,31 @@ void drawChecklistStatic() {
     int16_t ty = topSpacing + CHAR_H + betweenSetupAndPiece + pieceYOffset
                + i*(CHAR_H*2 + textBoxGap + itemGap);
     int16_t lx = (matrix.width() - ln*CHAR_W)/2;
-    matrix.setCursor(lx, ty);
-    matrix.print(L);
+    textDrawLabel(lx, ty, L, white);
 
     int16_t bx = (matrix.width() - chkBoxW)/2;
     int16_t by = ty + CHAR_H + textBoxGap;
     uint16_t col = (prevChecklist[i] == 1)
                   ? matrix.color565(0,255,0)
                   : matrix.color565(255,0,0);
-    matrix.fillRect(bx, by, chkBoxW, chkBoxH, col);
+    blitSprite(spriteCheckBox, bx, by, &col);
   }
 
   // bottom status
   if (!gReadyState) {
-    matrix.setTextColor(matrix.color565(255,0,0));
-    matrix.setCursor((matrix.width()-3*CHAR_W)/2,
-                     matrix.height()-CHAR_H*2);
-    matrix.print("NOT");
-    matrix.setCursor((matrix.width()-5*CHAR_W)/2,
-                     matrix.height()-CHAR_H);
-    matrix.print("READY");
+    uint16_t red = matrix.color565(255,0,0);
+    textDrawLabel((matrix.width()-3*CHAR_W)/2,
+                  matrix.height()-CHAR_H*2, "NOT", red);
+    textDrawLabel((matrix.width()-5*CHAR_W)/2,
+                  matrix.height()-CHAR_H, "READY", red);
   }
 
   matrix.show();
 }
 
-// process checklist payload: parse csv flags, update states, animate changes and update ready status
-void processChecklistPayload(const char* payload) {
-  // parse CSV
-  int states[numChecklist] = {0};
-  char tmp[32];
-  strncpy(tmp, payload, sizeof(tmp)-1);
-  tmp[sizeof(tmp)-1] = '\0';
-  char *p = tmp;
-  for (uint8_t i = 0; i < numChecklist; i++) {
-    states[i] = atoi(p);
-    char *comma = strchr(p, ',');
-    if (!comma) break;
-    p = comma + 1;
-  }
+// process checklist message: update states from parsed flags, animate changes and update ready status
+void processChecklistMessage(const ChecklistMsg &msg) {
+  const uint8_t *states = msg.state;
 
   // handle drop from scroller to not-ready baseline
   bool newAllGreen = true;
@@ -123,29 +115,24 @@ void processChecklistPayload(const char* payload) {
     readyTimestamp  = 0;
     // draw full green checklist baseline
     matrix.fillScreen(0);
-    matrix.setTextColor(matrix.color565(255,255,255));
-    matrix.setCursor((matrix.width()-5*CHAR_W)/2, topSpacing);
-    matrix.print("MATCH");
-    matrix.setCursor((matrix.width()-5*CHAR_W)/2, topSpacing+CHAR_H);
-    matrix.print("SETUP");
+    uint16_t white = matrix.color565(255,255,255);
+    textDrawLabel((matrix.width()-5*CHAR_W)/2, topSpacing, "MATCH", white);
+    textDrawLabel((matrix.width()-5*CHAR_W)/2, topSpacing+CHAR_H, "SETUP", white);
     for (uint8_t i = 0; i < numChecklist; i++) {
       const char* L = checklistItems[i];
       int16_t ln = strlen(L);
       int16_t ty = topSpacing + CHAR_H + betweenSetupAndPiece + pieceYOffset
                    + i*(CHAR_H*2 + textBoxGap + itemGap);
       int16_t lx = (matrix.width()-ln*CHAR_W)/2;
-      matrix.setCursor(lx, ty);
-      matrix.print(L);
+      textDrawLabel(lx, ty, L, white);
       int16_t bx = (matrix.width()-chkBoxW)/2;
       int16_t by = ty + CHAR_H + textBoxGap;
-      matrix.fillRect(bx, by, chkBoxW, chkBoxH,
-                      matrix.color565(0,255,0));
+      uint16_t green = matrix.color565(0,255,0);
+      blitSprite(spriteCheckBox, bx, by, &green);
       prevChecklist[i] = 1;
     }
-    matrix.setTextColor(matrix.color565(0,255,0));
-    matrix.setCursor((matrix.width()-5*CHAR_W)/2,
-                     matrix.height()-CHAR_H);
-    matrix.print("READY");
+    textDrawLabel((matrix.width()-5*CHAR_W)/2,
+                  matrix.height()-CHAR_H, "READY", matrix.color565(0,255,0));
     matrix.show();
     // continue to animate below
   }
@@ -167,6 +154,12 @@ void processChecklistPayload(const char* payload) {
     if (prevChecklist[i] == 0) allGreen = false;
   }
 
+  if (changedCount) {
+    uint8_t bits = 0;
+    for (uint8_t i = 0; i < numChecklist; i++) bits |= (prevChecklist[i] == 1) << i;
+    journalEvent(JEV_CHECKLIST, bits, numChecklist);
+  }
+
   // animate box fills
   if (changedCount) {
     for (uint8_t step = 0; step < chkBoxW; step++) {
@@ -182,7 +175,7 @@ void processChecklistPayload(const char* payload) {
         matrix.drawFastVLine(lx+xOff, ly+CHAR_H+textBoxGap, chkBoxH, col);
       }
       matrix.show();
-      delay(boxDelay/chkBoxW);
+      cpuDelay(boxDelay/chkBoxW);
     }
   }
 
@@ -197,7 +190,7 @@ void processChecklistPayload(const char* payload) {
     const char* n="NOT"; int16_t xNot=(sw-3*CHAR_W)/2;
     for (uint8_t j=0;j<3;j++){
       matrix.fillRect(xNot+j*CHAR_W,y4,CHAR_W,CHAR_H,white);
-      matrix.show(); delay(typeDelay);
+      matrix.show(); cpuDelay(typeDelay);
       matrix.fillRect(xNot+j*CHAR_W,y4,CHAR_W,CHAR_H,black);
       matrix.show();
     }
@@ -205,11 +198,9 @@ void processChecklistPayload(const char* payload) {
     for (uint8_t j=0;j<5;j++){
       int16_t cx=xR+j*CHAR_W;
       matrix.fillRect(cx,y4+CHAR_H,CHAR_W,CHAR_H,white);
-      matrix.show(); delay(typeDelay);
+      matrix.show(); cpuDelay(typeDelay);
       matrix.fillRect(cx,y4+CHAR_H,CHAR_W,CHAR_H,black);
-      matrix.setTextColor(green);
-      matrix.setCursor(cx,y4+CHAR_H);
-      matrix.print(r[j]);
+      textDrawChar(cx,y4+CHAR_H,r[j],green);
       matrix.show();
     }
     gReadyState=true;
@@ -219,22 +210,18 @@ void processChecklistPayload(const char* payload) {
     for (uint8_t j=0;j<3;j++){
       int16_t cx=xNot+j*CHAR_W;
       matrix.fillRect(cx,y4,CHAR_W,CHAR_H,white);
-      matrix.show(); delay(typeDelay);
+      matrix.show(); cpuDelay(typeDelay);
       matrix.fillRect(cx,y4,CHAR_W,CHAR_H,black);
-      matrix.setTextColor(red);
-      matrix.setCursor(cx,y4);
-      matrix.print(n[j]);
+      textDrawChar(cx,y4,n[j],red);
       matrix.show();
     }
     const char* r="READY"; int16_t xR=(sw-5*CHAR_W)/2;
     for (uint8_t j=0;j<5;j++){
       int16_t cx=xR+j*CHAR_W;
       matrix.fillRect(cx,y4+CHAR_H,CHAR_W,CHAR_H,white);
-      matrix.show(); delay(typeDelay);
+      matrix.show(); cpuDelay(typeDelay);
       matrix.fillRect(cx,y4+CHAR_H,CHAR_W,CHAR_H,black);
-      matrix.setTextColor(red);
-      matrix.setCursor(cx,y4+CHAR_H);
-      matrix.print(r[j]);
+      textDrawChar(cx,y4+CHAR_H,r[j],red);
       matrix.show();
     }
     gReadyState=false;
@@ -247,8 +234,9 @@ void readAndProcess(Stream &in, const char *label) {
   // line per call to this function.  Otherwise, process each line
   // as it arrives.  This prevents long queues of updates from
   // saturating the animation pipeline when sensors toggle rapidly.
-  const size_t cap = 32;
+  const size_t cap = BUF_SIZE;
   static size_t fill = 0;
+  static bool overflow = false;
   if (dripFeedMode) {
     bool gotLine = false;
     char lastLine[32];
@@ -256,14 +244,17 @@ void readAndProcess(Stream &in, const char *label) {
       int b = in.read();
       if (b < 0) break;
       char c = (char)b;
+      rxByte(RX_USB);
       if (c == '\r') continue;
       if (c != '\n') {
         if (fill < cap - 1) buf[fill++] = c;
+        else rxOverflowByte(RX_USB, overflow);
         continue;
       }
       // newline terminator
       buf[fill] = '\0';
       fill = 0;
+      rxLineEnd(RX_USB, overflow);
       if (buf[0] != '\0') {
         strncpy(lastLine, buf, sizeof(lastLine));
         lastLine[sizeof(lastLine)-1] = '\0';
@@ -272,10 +263,7 @@ void readAndProcess(Stream &in, const char *label) {
     }
     if (gotLine) {
       // log the raw line
-      Serial.print("received on ");
-      Serial.print(label);
-      Serial.print(" (drip): ");
-      Serial.println(lastLine);
+      LOG_INFO("received on %s (drip): %s", label, lastLine);
       // In drip mode, the message may include a mode prefix (0/1/2) and
       // a space before the comma‑separated checklist data.  Skip the
       // mode token so that the first number isn't misinterpreted as
@@ -289,36 +277,38 @@ void readAndProcess(Stream &in, const char *label) {
       if ((p[0] == '0' || p[0] == '1' || p[0] == '2') && p[1] == ' ') {
         p += 2;
       }
-      // skip any additional spaces after the mode
-      while (*p == ' ') ++p;
       // if there's no payload after the mode, don't update the checklist
-      if (*p != '\0') {
-        processChecklistPayload(p);
+      Message msg;
+      if (parsePayload(p, MODE_CHECKLIST, msg)) {
+        processChecklistMessage(msg.payload.checklist);
       }
     }
   } else {
-    // Uses global buf (allocated with new char[32] in setup)
+    // Uses the global line buffer buf[BUF_SIZE]
     while (in.available()) {
       int b = in.read();
       if (b < 0) break;
       char c = (char)b;
+      rxByte(RX_USB);
 
       if (c == '\r') continue;
       if (c != '\n') {
         if (fill < cap - 1) buf[fill++] = c;
+        else rxOverflowByte(RX_USB, overflow);
         continue;
       }
 
       buf[fill] = '\0';
       fill = 0;
+      rxLineEnd(RX_USB, overflow);
       if (buf[0] == '\0') continue;
 
-      Serial.print("received on ");
-      Serial.print(label);
-      Serial.print(": ");
-      Serial.println(buf);
+      LOG_INFO("received on %s: %s", label, buf);
 
-      processChecklistPayload(buf);
+      Message msg;
+      if (parsePayload(buf, MODE_CHECKLIST, msg)) {
+        processChecklistMessage(msg.payload.checklist);
+      }
     }
   }
 }
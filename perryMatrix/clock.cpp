@@ -0,0 +1,30 @@
+// © 2025 SC5K Systems
+
+#include "src/clock.h"
+
+#if CLOCK_VIRTUAL
+// 64-bit so long scripted runs never wrap internally; callers see the same
+// 32-bit wrap as millis()/micros() on the board
+static uint64_t nowUs = 0;
+
+unsigned long clockMillis() {
+  return (unsigned long)(nowUs / 1000);
+}
+
+unsigned long clockMicros() {
+  return (unsigned long)nowUs;
+}
+
+void clockDelay(unsigned long ms) {
+  nowUs += (uint64_t)ms * 1000;
+}
+
+void clockWaitMicros(unsigned long until) {
+  long ahead = (long)(until - (unsigned long)nowUs);
+  if (ahead > 0) nowUs += ahead;
+}
+
+void clockAdvance(unsigned long us) {
+  nowUs += us;
+}
+#endif
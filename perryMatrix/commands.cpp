@@ -0,0 +1,316 @@
+// © 2025 SC5K Systems
+
+#include "src/commands.h"
+#include "src/sprite.h"
+#include "src/dynamic.h"
+#include "src/text.h"
+#include "src/display.h"
+#include "src/autonomous.h"
+#include "src/matrix_config.h"
+#include "src/profiler.h"
+#include "src/cpu.h"
+#include "src/latency.h"
+#include "src/drip.h"
+#include "src/message.h"
+#include "src/journal.h"
+#include "src/capture.h"
+#include "src/rxstats.h"
+#include "src/boot_sequence.h"
+#include "src/settings.h"
+#include "src/mem.h"
+#include "src/mode.h"
+#include "src/transition.h"
+#include "src/pacer.h"
+#include "src/power.h"
+#include "src/params.h"
+#include "src/bench.h"
+#include <stdlib.h>
+#include <Arduino.h>
+#include <string.h>
+
+// diagnostic commands typed on USB or sent by the RoboRIO as "?name [args]".
+// they never change the current mode, so they are safe to run mid-match. ?bench, ?mb and ?prim
+// are the exception: they take the canvas and start the mode over, so they only run from USB
+// and before a match (bench.h). ?cap replay drives the modes itself and has the same limits.
+struct DebugCommand {
+  const char *name;
+  void (*run)(const char *args);
+  const char *help;
+};
+
+static void cmdHelp(const char *args);
+
+// source of the command being run
+static RxSource source = RX_USB;
+
+// usbOnly: refuse a command the RoboRIO sent
+static bool usbOnly(const char *name) {
+  if (source == RX_USB) return true;
+  Serial.print(name);
+  Serial.println(": USB only");
+  return false;
+}
+
+static void cmdBlit(const char *args) {
+  (void)args;
+  benchSpriteBlit();
+}
+
+static void cmdAnim(const char *args) {
+  (void)args;
+  reportDynamicAnim();
+}
+
+static void cmdText(const char *args) {
+  (void)args;
+  benchText();
+}
+
+static void cmdPrim(const char *args) {
+  (void)args;
+  if (usbOnly("prim") && benchIdle("prim")) benchPrimitives();
+}
+
+static void cmdClip(const char *args) {
+  if (strcmp(args, "gfx") == 0) matrix.clipFast = false;
+  else if (strcmp(args, "fast") == 0) matrix.clipFast = true;
+  benchAutonomousClip();
+}
+
+static void cmdProf(const char *args) {
+  if (strcmp(args, "reset") == 0) {
+    profReset();
+    Serial.println("profiler reset");
+    return;
+  }
+  profReport();
+}
+
+static void cmdCpu(const char *args) {
+  (void)args;
+  cpuReport();
+}
+
+static void cmdLat(const char *args) {
+  (void)args;
+  reportLatency();
+}
+
+static void cmdDrip(const char *args) {
+  (void)args;
+  benchDrip();
+}
+
+static void cmdParse(const char *args) {
+  (void)args;
+  benchParse();
+}
+
+static void cmdLog(const char *args) {
+  if (strcmp(args, "stat") == 0) journalReport();
+  else journalDump();
+}
+
+static void cmdCap(const char *args) {
+  if (strcmp(args, "start") == 0) captureStart();
+  else if (strcmp(args, "stop") == 0) captureStop();
+  else if (strcmp(args, "dump") == 0) {
+    captureDump();
+    return;
+  } else if (strcmp(args, "replay") == 0) {
+    // the replay stands in for Serial1 and switches modes, so not with a RoboRIO in charge
+    if (!usbOnly("cap replay") || !benchIdle("cap replay")) return;
+    replayStart();
+  }
+  else if (strcmp(args, "frame") == 0) {
+    // portrait canvas rows as hex 565
+    captureFrameDump(matrix.getBuffer(), HEIGHT, WIDTH, 0);
+    return;
+  }
+  captureReport();
+}
+
+// ?rx answers on the port it came in on, so a tool flooding Serial1 can read its own counters
+static void cmdRx(const char *args) {
+  Print &out = source == RX_USB ? (Print &)Serial : (Print &)robotInput();
+  if (strcmp(args, "reset") == 0) {
+    rxReset();
+    out.println("rx counters reset");
+    return;
+  }
+  rxReport(out);
+}
+
+static void cmdBoot(const char *args) {
+  if (strcmp(args, "fast") == 0 || strcmp(args, "full") == 0) {
+    settings.fastBoot = (strcmp(args, "fast") == 0);
+    if (!settingsSave()) Serial.println("boot: no flash, flag kept until reset");
+  }
+  bootReport();
+}
+
+static void cmdMem(const char *args) {
+  (void)args;
+  memReport();
+}
+
+static void cmdMode(const char *args) {
+  (void)args;
+  modeReport();
+}
+
+static void cmdFx(const char *args) {
+  if (*args) {
+    char name[12];
+    size_t n = 0;
+    while (args[n] && args[n] != ' ' && n < sizeof(name) - 1) { name[n] = args[n]; n++; }
+    name[n] = '\0';
+    if (!transitionSet(name, strtoul(args + n, nullptr, 10))) {
+      Serial.println("fx: cut, fade, wipe or dissolve [ms]");
+      return;
+    }
+  }
+  transitionReport();
+}
+
+static void cmdBlend(const char *args) {
+  (void)args;
+  benchBlend();
+}
+
+static void cmdPace(const char *args) {
+  if (strcmp(args, "on") == 0) pacerEnable(true);
+  else if (strcmp(args, "off") == 0) pacerEnable(false);
+  pacerReport();
+}
+
+static void cmdPwr(const char *args) {
+  if (strncmp(args, "bright ", 7) == 0) paramSet(*paramFind("brightness"), strtol(args + 7, nullptr, 10));
+  else if (*args >= '0' && *args <= '9') paramSet(*paramFind("pwrLimit"), strtol(args, nullptr, 10));
+  powerReport();
+}
+
+// printParam: "name = value"
+static void printParam(const Param &p) {
+  Serial.print(p.name);
+  Serial.print(" = ");
+  Serial.println(paramGet(p));
+}
+
+static void cmdGet(const char *args) {
+  const Param *p = paramFind(args);
+  if (!p) {
+    Serial.print("get: no parameter ");
+    Serial.println(args);
+    return;
+  }
+  printParam(*p);
+}
+
+static void cmdSet(const char *args) {
+  char name[20];
+  size_t n = 0;
+  while (args[n] && args[n] != ' ' && n < sizeof(name) - 1) { name[n] = args[n]; n++; }
+  name[n] = '\0';
+  const char *value = args + n;
+  while (*value == ' ') ++value;
+  const Param *p = paramFind(name);
+  if (!p || !*value) {
+    Serial.println("set: <name> <value|default>, ?list for names");
+    return;
+  }
+  if (strcmp(value, "default") == 0) {
+    paramReset(*p);
+  } else {
+    char *end;
+    long v = strtol(value, &end, 10);
+    if (*end || !paramSet(*p, v)) {
+      char line[56];
+      snprintf(line, sizeof(line), "set: %s takes %ld..%ld", p->name, (long)p->min, (long)p->max);
+      Serial.println(line);
+      return;
+    }
+  }
+  printParam(*p);
+}
+
+static void cmdList(const char *args) {
+  (void)args;
+  paramList();
+}
+
+static void cmdSave(const char *args) {
+  (void)args;
+  if (paramSave()) Serial.println("save: parameters and boot flag written to flash");
+  else Serial.println("save: no flash, values kept until reset");
+}
+
+static void cmdBench(const char *args) {
+  if (usbOnly("bench")) benchModes((uint16_t)strtoul(args, nullptr, 10));
+}
+
+static void cmdMb(const char *args) {
+  if (usbOnly("mb")) benchKernels((uint16_t)strtoul(args, nullptr, 10));
+}
+
+static const DebugCommand commands[] = {
+  { "help", cmdHelp, "list commands" },
+  { "blit", cmdBlit, "benchmark rle sprite blit vs legacy rects" },
+  { "anim", cmdAnim, "celebration animation playback stats" },
+  { "text", cmdText, "benchmark gfx print vs glyph atlas (glyphs/ms)" },
+  { "prim", cmdPrim, "primitive throughput, rotated panel canvas vs portrait canvas" },
+  { "prof", cmdProf, "frame profiler tree: calls, min/mean/p99/max us [reset]" },
+  { "cpu", cmdCpu, "per-mode isr/loop/idle % over a sliding window, worst loop gap" },
+  { "lat", cmdLat, "last traced #seq line: byte -> line -> parse -> apply -> show" },
+  { "drip", cmdDrip, "replay bursty traces through the drip-feed policy" },
+  { "parse", cmdParse, "benchmark schema parser vs strtol/atoi line parsing (lines/ms)" },
+  { "log", cmdLog, "stream the flash match journal, oldest first [stat: write counts/cost]" },
+  { "cap", cmdCap, "serial1 trace capture [start|stop|dump|replay|frame]" },
+  { "rx", cmdRx, "serial line readers: bytes, lines, truncated, merged, malformed [reset]" },
+  { "boot", cmdBoot, "reset to first frame timing and how the boot ended [fast|full saves the flag]" },
+  { "mem", cmdMem, "heap high-water, bytes in use and stack gap at start, panel up, boot end and now" },
+  { "mode", cmdMode, "mode switch latency per transition (dispatch -> first frame) and pre-warm" },
+  { "fx", cmdFx, "mode switch effect [cut|fade|wipe|dissolve] [ms]" },
+  { "blend", cmdBlend, "benchmark transition blends, px/us (swar fade vs per-pixel scalar)" },
+  { "pace", cmdPace, "frame pacer per mode: target/achieved fps, frame cost, overruns, skips [on|off]" },
+  { "get", cmdGet, "print a tunable parameter: ?get <name>" },
+  { "set", cmdSet, "change a parameter live: ?set <name> <value|default>" },
+  { "list", cmdList, "all tunable parameters with value, range and what they do" },
+  { "save", cmdSave, "keep changed parameters (and the boot flag) across resets" },
+  { "pwr", cmdPwr, "estimated panel current, limiter and estimate cost [<mA> limit|bright <0-255>]" },
+  { "bench", cmdBench, "render every mode and dynamic state offscreen, us/frame and fps, then show() [frames]" },
+  { "mb", cmdMb, "microbenchmark hot-loop helpers and geometry kernels, ns/call +-95% and min [calls]" },
+  { "clip", cmdClip, "autonomous pixels visited, gfx vs clipped [gfx|fast sets live mode]" },
+};
+static const uint8_t commandCount = sizeof(commands) / sizeof(commands[0]);
+
+static void cmdHelp(const char *args) {
+  (void)args;
+  for (uint8_t i = 0; i < commandCount; i++) {
+    Serial.print("?");
+    Serial.print(commands[i].name);
+    Serial.print("  ");
+    Serial.println(commands[i].help);
+  }
+}
+
+// handleDebugCommand: match the first token against the command table and pass the rest as args
+bool handleDebugCommand(const char *line, RxSource src) {
+  while (*line == ' ') ++line;
+  if (*line != '?') return false;
+  ++line;
+  size_t n = 0;
+  while (line[n] && line[n] != ' ') n++;
+  const char *args = line + n;
+  while (*args == ' ') ++args;
+  for (uint8_t i = 0; i < commandCount; i++) {
+    if (strlen(commands[i].name) == n && strncmp(commands[i].name, line, n) == 0) {
+      source = src;
+      commands[i].run(args);
+      return true;
+    }
+  }
+  Serial.print("unknown command, try ?help: ");
+  Serial.println(line);
+  return true;
+}
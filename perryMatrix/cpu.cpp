@@ -0,0 +1,186 @@
+// © 2025 SC5K Systems
+
+#include "src/cpu.h"
+#include "src/profiler.h"
+#include "src/clock.h"
+#include "src/mode.h"
+#include <Arduino.h>
+#include <stdio.h>
+
+// Protomatter's refresh runs from a timer interrupt we can't hook, so ISR time is
+// measured from the gaps it leaves in our own idle spins: a tight loop reading the
+// tick counter advances by a few ticks per pass, and any pass that took much longer
+// was interrupted. the ISR share seen while idle is applied to the busy part too,
+// since the refresh timer fires at the same rate regardless of what loop() is doing.
+
+#ifdef ARDUINO
+#define CPU_TICKS_PER_MS (SystemCoreClock / 1000UL)
+#else
+#define CPU_TICKS_PER_MS 1000000UL
+#endif
+
+struct CpuBucket {
+  uint32_t total, idle, isr;   // ticks: wall time, idle-spin wall time, stolen inside idle spins
+};
+
+struct CpuWindow {
+  CpuBucket bucket[CPU_BUCKETS];
+  uint8_t   head;
+  uint32_t  maxGap;            // longest loop() pass (ticks) since the last report
+};
+
+static CpuWindow windows[MODE_SLOTS];
+static uint32_t gapThreshold = 64;   // an idle pass longer than this was interrupted
+static uint32_t baseIsrPermille = 0; // boot-time ISR share, used when a window has no idle
+static uint32_t lastTick = 0;
+static uint32_t pendingIdle = 0, pendingIsr = 0;
+static uint32_t pendingSleep = 0;    // slept ticks the cycle counter never saw
+
+// idleSpin: spin for 'ticks', returning how many of them were stolen by interrupts
+static uint32_t idleSpin(uint32_t ticks) {
+  uint32_t start = profNow(), prev = start, stolen = 0;
+  for (;;) {
+    uint32_t now = profNow();
+    uint32_t pass = now - prev;
+    if (pass > gapThreshold) stolen += pass;
+    prev = now;
+    if (now - start >= ticks) break;
+  }
+  return stolen;
+}
+
+void cpuInit() {
+  // undisturbed pass length, then 4x margin for the odd flash wait state
+  uint32_t worst = 0;
+  noInterrupts();
+  uint32_t prev = profNow();
+  for (uint16_t i = 0; i < 2000; i++) {
+    uint32_t now = profNow();
+    if (now - prev > worst) worst = now - prev;
+    prev = now;
+  }
+  interrupts();
+  gapThreshold = max(worst * 4, (uint32_t)64);
+
+  uint32_t span = 20 * CPU_TICKS_PER_MS;
+  baseIsrPermille = (uint32_t)((uint64_t)idleSpin(span) * 1000 / span);
+  lastTick = profNow();
+}
+
+void cpuDelay(unsigned long ms) {
+#if CLOCK_VIRTUAL
+  // simulated time: skip the wait instead of spinning through it
+  clockDelay(ms);
+#else
+  uint32_t ticks = (uint32_t)ms * CPU_TICKS_PER_MS;
+  uint32_t t0 = profNow();
+  pendingIsr  += idleSpin(ticks);
+  pendingIdle += profNow() - t0;
+#endif
+}
+
+void cpuWaitMicros(unsigned long until) {
+#if CLOCK_VIRTUAL
+  clockWaitMicros(until);
+#else
+  uint32_t t0 = profNow(), prev = t0, stolen = 0;
+  while ((long)(clockMicros() - until) < 0) {
+    uint32_t now = profNow();
+    if (now - prev > gapThreshold) stolen += now - prev;
+    prev = now;
+  }
+  pendingIsr  += stolen;
+  pendingIdle += profNow() - t0;
+#endif
+}
+
+void cpuSleepUntil(unsigned long until, bool (*wake)()) {
+#if CLOCK_VIRTUAL
+  // simulated time: input only arrives between passes, so jump straight to the deadline
+  if (!wake()) clockWaitMicros(until);
+#elif defined(ARDUINO)
+  // the cycle counter stops while the core sleeps and runs for the interrupts that wake it,
+  // so wall time comes from micros() and the cycles that did pass are the ISR's share
+  uint32_t c0 = profNow();
+  unsigned long t0 = clockMicros();
+  while ((long)(clockMicros() - until) < 0 && !wake()) __WFI();
+  uint32_t wall  = (uint32_t)(clockMicros() - t0) * (CPU_TICKS_PER_MS / 1000);
+  uint32_t awake = min(profNow() - c0, wall);
+  pendingSleep += wall - awake;
+  pendingIdle  += wall;
+  pendingIsr   += awake;
+#else
+  uint32_t t0 = profNow();
+  while ((long)(clockMicros() - until) < 0 && !wake()) {}
+  pendingIdle += profNow() - t0;
+#endif
+}
+
+void cpuTick(Mode mode) {
+  uint32_t now = profNow();
+  uint32_t elapsed = now - lastTick;
+  lastTick = now;
+
+  uint8_t slot = modeSlot(mode);
+  CpuWindow &w = windows[slot < MODE_SLOTS ? slot : 0];
+  // a sleep wakes on serial input, so it isn't a gap in reading Serial1
+  if (elapsed > w.maxGap) w.maxGap = elapsed;
+  elapsed += pendingSleep;
+  pendingSleep = 0;
+  CpuBucket *b = &w.bucket[w.head];
+  if (b->total >= CPU_BUCKET_MS * CPU_TICKS_PER_MS) {
+    w.head = (w.head + 1) % CPU_BUCKETS;
+    b = &w.bucket[w.head];
+    b->total = b->idle = b->isr = 0;
+  }
+  b->total += elapsed;
+  b->idle  += min(pendingIdle, elapsed);
+  b->isr   += min(pendingIsr, elapsed);
+  pendingIdle = pendingIsr = 0;
+}
+
+static void printPct(uint32_t permille) {
+  char cell[10];
+  snprintf(cell, sizeof(cell), "%5lu.%lu", (unsigned long)(permille / 10), (unsigned long)(permille % 10));
+  Serial.print(cell);
+}
+
+void cpuReport() {
+  Serial.print("cpu per mode, window ");
+  Serial.print(CPU_BUCKETS * CPU_BUCKET_MS);
+  Serial.print(" ms, isr at idle ");
+  Serial.print(baseIsrPermille / 10);
+  Serial.print(".");
+  Serial.print(baseIsrPermille % 10);
+  Serial.println("%");
+  Serial.println("mode          sec   isr%  loop%  idle%  maxgap ms  (rx bytes @9600)");
+  for (uint8_t m = 0; m < MODE_SLOTS; m++) {
+    CpuWindow &w = windows[m];
+    uint64_t total = 0, idle = 0, isr = 0;
+    for (uint8_t i = 0; i < CPU_BUCKETS; i++) {
+      total += w.bucket[i].total;
+      idle  += w.bucket[i].idle;
+      isr   += w.bucket[i].isr;
+    }
+    if (!total) continue;
+
+    // isr share measured inside idle spins, applied to the whole window
+    uint32_t isrPm  = idle > CPU_TICKS_PER_MS ? (uint32_t)(isr * 1000 / idle) : baseIsrPermille;
+    uint32_t idlePm = (uint32_t)((idle - isr) * 1000 / total);
+    uint32_t loopPm = 1000 > isrPm + idlePm ? 1000 - isrPm - idlePm : 0;
+
+    char head[24];
+    snprintf(head, sizeof(head), "%-11s%5lu.%lu", modeName((int8_t)m - 1),
+             (unsigned long)(total / CPU_TICKS_PER_MS / 1000),
+             (unsigned long)(total / CPU_TICKS_PER_MS / 100 % 10));
+    Serial.print(head);
+    printPct(isrPm);
+    printPct(loopPm);
+    printPct(idlePm);
+    // serial1 keeps arriving while loop() is away from handleRobotMessage()
+    uint32_t gapMs = w.maxGap / CPU_TICKS_PER_MS;
+    snprintf(head, sizeof(head), "%11lu  (%lu)", (unsigned long)gapMs, (unsigned long)(gapMs * 960 / 1000));
+    Serial.println(head);
+    w.maxGap = 0;
+  }
+}
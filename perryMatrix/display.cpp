@@ -0,0 +1,333 @@
+// © 2025 SC5K Systems
+
+#include "src/display.h"
+#include "src/matrix_config.h"
+#include "src/profiler.h"
+#include "src/latency.h"
+#include "src/capture.h"
+#include "src/transition.h"
+#include "src/power.h"
+#include "src/mode.h"
+#include <Arduino.h>
+#include <utility>
+
+// the panel is WIDTH x HEIGHT landscape; the portrait canvas is HEIGHT x WIDTH
+PerryDisplay::PerryDisplay(Adafruit_Protomatter &out)
+  : GFXcanvas16(HEIGHT, WIDTH), panel(out) {}
+
+ProtomatterStatus PerryDisplay::begin() {
+  return panel.begin();
+}
+
+// present: portrait (px, py) lands on panel (WIDTH-1-py, px), the same mapping
+// setRotation(1) used to apply per pixel. one portrait row becomes one panel column.
+void PerryDisplay::present() {
+  const uint16_t *src = getBuffer();
+  uint16_t *dst = panel.getBuffer();
+  if (!src || !dst) return;
+
+  for (int16_t py = 0; py < WIDTH; py++) {
+    const uint16_t *row = src + py * HEIGHT;
+    uint16_t *col = dst + (WIDTH - 1 - py);
+    for (int16_t px = 0; px < HEIGHT; px += 4) {
+      col[0]         = row[0];
+      col[WIDTH]     = row[1];
+      col[2 * WIDTH] = row[2];
+      col[3 * WIDTH] = row[3];
+      row += 4;
+      col += 4 * WIDTH;
+    }
+  }
+}
+
+void PerryDisplay::show() {
+  if (offscreen) return;
+  PROFILE_SCOPE("show");
+  present();
+  transitionApply(panel.getBuffer());
+  powerFrame(panel.getBuffer(), WIDTH * HEIGHT);
+  panel.show();
+  shows++;
+  traceShown();
+  replayFrame();
+}
+
+void PerryDisplay::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  pixelVisits++;
+  GFXcanvas16::drawPixel(x, y, color);
+}
+
+void PerryDisplay::clippedRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+  int32_t x1 = min(x + w, (int32_t)_width), y1 = min(y + h, (int32_t)_height);
+  x = max(x, (int32_t)0);
+  y = max(y, (int32_t)0);
+  if (x >= x1 || y >= y1) return;
+  pixelVisits += (uint32_t)(x1 - x) * (y1 - y);
+  uint16_t *row = getBuffer() + y * _width + x;
+  for (; y < y1; y++, row += _width) {
+    for (int32_t i = 0; i < x1 - x; i++) row[i] = color;
+  }
+}
+
+void PerryDisplay::clippedVLine(int16_t x, int32_t y, int32_t h, uint16_t color) {
+  if (x < 0 || x >= _width) return;
+  int32_t y1 = min(y + h, (int32_t)_height);
+  y = max(y, (int32_t)0);
+  if (y >= y1) return;
+  pixelVisits += y1 - y;
+  uint16_t *p = getBuffer() + y * _width + x;
+  for (; y < y1; y++, p += _width) *p = color;
+}
+
+// negative lengths extend up/left from the start point, as in GFXcanvas16
+void PerryDisplay::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if (!fastPath()) {
+    pixelVisits += abs(h);
+    GFXcanvas16::drawFastVLine(x, y, h, color);
+    return;
+  }
+  if (h < 0) { h = -h; y -= h - 1; }
+  clippedVLine(x, y, h, color);
+}
+
+void PerryDisplay::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (!fastPath()) {
+    pixelVisits += abs(w);
+    GFXcanvas16::drawFastHLine(x, y, w, color);
+    return;
+  }
+  if (w < 0) { w = -w; x -= w - 1; }
+  clippedRect(x, y, w, 1, color);
+}
+
+void PerryDisplay::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (!fastPath()) {
+    GFXcanvas16::fillRect(x, y, w, h, color);
+    return;
+  }
+  if (w <= 0) return;
+  if (h < 0) { h = -h; y -= h - 1; }
+  clippedRect(x, y, w, h, color);
+}
+
+// drawLine: same stepping as GFX writeLine. after the steep/direction swaps the major
+// axis advances one pixel per step i, and the minor axis has moved k(i) times where
+// k(i) = ceil((i*dy - dx/2) / dx). inverting that gives the first and last step whose
+// minor coordinate is on the canvas, so only visible pixels are ever generated.
+void PerryDisplay::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  if (!fastPath()) {
+    GFXcanvas16::drawLine(x0, y0, x1, y1, color);
+    return;
+  }
+  if (x0 == x1) {
+    if (y0 > y1) std::swap(y0, y1);
+    clippedVLine(x0, y0, (int32_t)y1 - y0 + 1, color);
+    return;
+  }
+  if (y0 == y1) {
+    if (x0 > x1) std::swap(x0, x1);
+    clippedRect(x0, y0, (int32_t)x1 - x0 + 1, 1, color);
+    return;
+  }
+
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) { std::swap(x0, y0); std::swap(x1, y1); }
+  if (x0 > x1) { std::swap(x0, x1); std::swap(y0, y1); }
+
+  const int32_t majorMax = steep ? _height : _width;
+  const int32_t minorMax = steep ? _width : _height;
+  const int32_t dx = x1 - x0, dy = abs(y1 - y0), half = dx / 2;
+  const int32_t ystep = (y0 < y1) ? 1 : -1;
+
+  // steps whose major coordinate is visible
+  int32_t iFirst = max((int32_t)0, (int32_t)-x0);
+  int32_t iLast  = min(dx, majorMax - 1 - x0);
+
+  // minor moves allowed before leaving the canvas on either side
+  int32_t kLo = (ystep > 0) ? -y0 : y0 - (minorMax - 1);
+  int32_t kHi = (ystep > 0) ? minorMax - 1 - y0 : y0;
+  if (kHi < 0) return;
+  if (kLo > 0) iFirst = max(iFirst, ((kLo - 1) * dx + half) / dy + 1);
+  iLast = min(iLast, (kHi * dx + half) / dy);
+  if (iFirst > iLast) return;
+
+  // bresenham state as it would be after iFirst steps
+  int32_t n   = iFirst * dy - half;
+  int32_t k   = (n > 0) ? (n + dx - 1) / dx : 0;
+  int32_t err = half - iFirst * dy + k * dx;
+  int32_t major = x0 + iFirst, minor = y0 + ystep * k;
+
+  const int32_t majorStride = steep ? _width : 1;
+  const int32_t minorStride = steep ? ystep : ystep * _width;
+  int32_t idx = steep ? major * _width + minor : minor * _width + major;
+  uint16_t *fb = getBuffer();
+  pixelVisits += iLast - iFirst + 1;
+  for (int32_t i = iFirst; i <= iLast; i++) {
+    fb[idx] = color;
+    if (i == iLast) break;
+    idx += majorStride;
+    err -= dy;
+    if (err < 0) { idx += minorStride; err += dx; }
+  }
+}
+
+// drawCircle: GFX's midpoint walk. x only grows and y only shrinks, so once an octant
+// pair's column (or row) has left the canvas on both sides it never comes back
+void PerryDisplay::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  if (!fastPath()) {
+    GFXcanvas16::drawCircle(x0, y0, r, color);
+    return;
+  }
+  const int16_t w = _width, h = _height;
+  if (x0 + r < 0 || x0 - r >= w || y0 + r < 0 || y0 - r >= h) return;
+
+  uint16_t *fb = getBuffer();
+  auto put = [&](int16_t px, int16_t py) {
+    fb[py * w + px] = color;
+    pixelVisits++;
+  };
+  auto colOk = [&](int16_t px) { return px >= 0 && px < w; };
+  auto rowOk = [&](int16_t py) { return py >= 0 && py < h; };
+
+  if (colOk(x0)) {
+    if (rowOk(y0 + r)) put(x0, y0 + r);
+    if (rowOk(y0 - r)) put(x0, y0 - r);
+  }
+  if (rowOk(y0)) {
+    if (colOk(x0 + r)) put(x0 + r, y0);
+    if (colOk(x0 - r)) put(x0 - r, y0);
+  }
+
+  int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  bool capsLive = true, sidesLive = true;   // octants at (x0±x, y0±y) / (x0±y, y0±x)
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    if (capsLive) {
+      if (x0 - x < 0 && x0 + x >= w) capsLive = false;
+      bool l = colOk(x0 - x), rt = colOk(x0 + x);
+      bool top = rowOk(y0 - y), bot = rowOk(y0 + y);
+      if (rt && bot) put(x0 + x, y0 + y);
+      if (l  && bot) put(x0 - x, y0 + y);
+      if (rt && top) put(x0 + x, y0 - y);
+      if (l  && top) put(x0 - x, y0 - y);
+    }
+    if (sidesLive) {
+      if (y0 - x < 0 && y0 + x >= h) sidesLive = false;
+      bool top = rowOk(y0 - x), bot = rowOk(y0 + x);
+      bool l = colOk(x0 - y), rt = colOk(x0 + y);
+      if (rt && bot) put(x0 + y, y0 + x);
+      if (l  && bot) put(x0 - y, y0 + x);
+      if (rt && top) put(x0 + y, y0 - x);
+      if (l  && top) put(x0 - y, y0 - x);
+    }
+    if (!capsLive && !sidesLive) break;
+  }
+}
+
+// fillCircle: GFX's column spans from the same walk, each clipped once or skipped whole
+void PerryDisplay::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  if (!fastPath()) {
+    GFXcanvas16::fillCircle(x0, y0, r, color);
+    return;
+  }
+  if (x0 + r < 0 || x0 - r >= _width || y0 + r < 0 || y0 - r >= _height) return;
+
+  clippedVLine(x0, y0 - r, 2 * r + 1, color);
+  int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r, px = x, py = y;
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (x < y + 1) {
+      clippedVLine(x0 + x, y0 - y, 2 * y + 1, color);
+      clippedVLine(x0 - x, y0 - y, 2 * y + 1, color);
+    }
+    if (y != py) {
+      clippedVLine(x0 + py, y0 - px, 2 * px + 1, color);
+      clippedVLine(x0 - py, y0 - px, 2 * px + 1, color);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+void PerryDisplay::saveCanvas() {
+  if (getBuffer() && panel.getBuffer()) memcpy(panel.getBuffer(), getBuffer(), WIDTH * HEIGHT * sizeof(uint16_t));
+}
+
+void PerryDisplay::restoreCanvas() {
+  if (getBuffer() && panel.getBuffer()) memcpy(getBuffer(), panel.getBuffer(), WIDTH * HEIGHT * sizeof(uint16_t));
+}
+
+// primitive mix run against either surface; both are 32x128 logically
+static unsigned long timePrimitive(Adafruit_GFX &g, uint8_t which, uint16_t reps) {
+  const int16_t w = g.width(), h = g.height();
+  unsigned long t0 = micros();
+  for (uint16_t n = 0; n < reps; n++) {
+    uint16_t c = (uint16_t)(n * 0x0841 + 1);
+    switch (which) {
+      case 0:
+        for (int16_t y = 0; y < h; y++)
+          for (int16_t x = 0; x < w; x++) g.drawPixel(x, y, c);
+        break;
+      case 1:
+        for (int16_t x = 0; x < w; x++) g.drawFastVLine(x, 0, h, c);
+        break;
+      case 2:
+        for (int16_t y = 0; y < h; y++) g.drawFastHLine(0, y, w, c);
+        break;
+      case 3:
+        g.fillRect(0, 0, w, h, c);
+        break;
+      default:
+        g.fillScreen(c);
+        break;
+    }
+  }
+  return micros() - t0;
+}
+
+// benchPrimitives: the old path drew through setRotation(1) on the panel canvas;
+// it is recreated here on the panel's own buffer (overwritten by the next show anyway)
+void benchPrimitives() {
+  static const char *const names[] = { "drawPixel", "vline", "hline", "fillRect", "fillScreen" };
+  const uint16_t reps = 20;
+  const uint32_t pixels = (uint32_t)WIDTH * HEIGHT * reps;
+
+  Serial.print("primitives (");
+  Serial.print(pixels);
+  Serial.println(" px each), px/us rotated -> native:");
+  for (uint8_t i = 0; i < 5; i++) {
+    panel.setRotation(1);
+    unsigned long rotUs = timePrimitive(panel, i, reps);
+    panel.setRotation(0);
+    unsigned long natUs = timePrimitive(matrix, i, reps);
+
+    Serial.print("  ");
+    Serial.print(names[i]);
+    Serial.print(": ");
+    Serial.print(rotUs ? (float)pixels / rotUs : 0.0f, 2);
+    Serial.print(" -> ");
+    Serial.println(natUs ? (float)pixels / natUs : 0.0f, 2);
+  }
+
+  // what the native path pays back once per frame, on the idle screen drawn again so the
+  // panel only ever gets a real frame through the blend and the current limit
+  modeRestore();
+  unsigned long t0 = micros();
+  for (uint16_t n = 0; n < reps; n++) matrix.present();
+  unsigned long presentUs = micros() - t0;
+  t0 = micros();
+  for (uint16_t n = 0; n < reps; n++) matrix.show();
+  unsigned long showUs = micros() - t0;
+  Serial.print("  transpose: ");
+  Serial.print(presentUs / reps);
+  Serial.print(" us/frame, show: ");
+  Serial.print(showUs / reps);
+  Serial.println(" us/frame");
+}
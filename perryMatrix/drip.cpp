@@ -0,0 +1,211 @@
+// © 2025 SC5K Systems
+
+#include "src/drip.h"
+#include "src/globals.h"
+#include "src/message.h"
+#include <Arduino.h>
+#include <string.h>
+
+// smoothed frame cost (us * 8) and whether that currently means coalescing
+static uint32_t costEma8 = 0;
+static bool heavy = false;
+
+// edgeSignature: the payload fields whose changes trigger one-shot behaviour.
+// dynamic: intake rising/falling edge, score level, climb state; checklist: all green.
+static uint16_t edgeSignature(const Message &msg) {
+  if (msg.format == PAYLOAD_DYNAMIC) {
+    const DynamicMsg &d = msg.payload.dynamic;
+    return (d.intake != 0) | ((uint16_t)d.score << 1) | ((uint16_t)d.climb << 8);
+  }
+  if (msg.format == PAYLOAD_CHECKLIST) {
+    for (uint8_t i = 0; i < numChecklist; i++) if (msg.payload.checklist.state[i] != 1) return 0;
+    return 1;
+  }
+  return 0;
+}
+
+uint8_t dripClassify(DripQueue &q, const char *text) {
+  const char *p = text;
+  while (*p == ' ') ++p;
+  if (*p == '#') {
+    ++p;
+    while (*p >= '0' && *p <= '9') ++p;
+  }
+
+  Message msg;
+  if (!parseMessage(p, msg)) {
+    // diagnostics always run; a malformed line is kept apart so it never stands in for a
+    // queued level update, and dispatch counts it
+    return msg.command ? DRIP_COMMAND : DRIP_MALFORMED;
+  }
+  uint16_t sig = edgeSignature(msg);
+
+  uint8_t kind = DRIP_LEVEL;
+  if (msg.mode != q.lastMode) kind = DRIP_TRANSITION;
+  else if (sig != q.lastSig) kind = DRIP_EDGE;
+  q.lastMode = msg.mode;
+  q.lastSig  = sig;
+  return kind;
+}
+
+bool dripFull(const DripQueue &q) {
+  return q.count >= DRIP_QUEUE_LEN;
+}
+
+void dripPush(DripQueue &q, const char *text, unsigned long byteUs, unsigned long lineUs, bool coalesce) {
+  // nothing pending: the stream picks up from what is actually applied
+  if (q.count == 0) q.lastMode = currentMode;
+  q.received++;
+  uint8_t kind = dripClassify(q, text);
+
+  DripLine *slot = nullptr;
+  if (coalesce && kind == DRIP_LEVEL && q.count) {
+    DripLine &tail = q.line[(q.head + q.count - 1) % DRIP_QUEUE_LEN];
+    if (tail.kind == DRIP_LEVEL) {
+      slot = &tail;
+      q.coalesced++;
+    }
+  }
+  if (!slot) {
+    if (dripFull(q)) return;   // caller broke the contract; the line is lost
+    slot = &q.line[(q.head + q.count) % DRIP_QUEUE_LEN];
+    q.count++;
+  }
+  strncpy(slot->text, text, DRIP_LINE_LEN - 1);
+  slot->text[DRIP_LINE_LEN - 1] = '\0';
+  slot->byteUs = byteUs;
+  slot->lineUs = lineUs;
+  slot->kind   = kind;
+}
+
+bool dripTake(DripQueue &q, DripLine &out) {
+  if (!q.count) return false;
+  out = q.line[q.head];
+  q.head = (q.head + 1) % DRIP_QUEUE_LEN;
+  q.count--;
+  return true;
+}
+
+bool dripPop(DripQueue &q, DripLine &out, uint8_t &budget) {
+  if (!budget || !dripTake(q, out)) return false;
+  budget--;
+  if (out.kind == DRIP_TRANSITION || out.kind == DRIP_EDGE) budget = 0;
+  return true;
+}
+
+bool dripNoteLoad(uint32_t frameUs) {
+  costEma8 = costEma8 - costEma8 / 8 + frameUs;   // ~8-pass moving average, scaled by 8
+  heavy = costEma8 / 8 > DRIP_HEAVY_MS * 1000UL;
+  return heavy;
+}
+
+uint8_t dripBudget() {
+  return heavy ? 1 : DRIP_QUEUE_LEN;
+}
+
+// replay: feed a burst in one poll, then drain poll by poll, recording the mode and
+// edge signature each dispatched line produces. every change present in the input
+// must show up in the output, in order.
+static bool replayBurst(const char *const *lines, uint8_t n, bool coalesce, uint8_t budgetPerPoll,
+                        uint8_t &dispatched, uint8_t &polls) {
+  static DripQueue q;
+  memset(&q, 0, sizeof(q));
+  Mode savedMode = currentMode;
+  currentMode = MODE_NULL;
+
+  // expected: the sequence of distinct (mode, sig) states in the input
+  static DripQueue ref;
+  memset(&ref, 0, sizeof(ref));
+  ref.lastMode = MODE_NULL;
+  uint16_t want[24];
+  uint8_t wantN = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    uint8_t k = dripClassify(ref, lines[i]);
+    if ((k == DRIP_TRANSITION || k == DRIP_EDGE) && wantN < 24) {
+      want[wantN++] = ((uint16_t)(ref.lastMode + 1) << 12) | ref.lastSig;
+    }
+  }
+
+  static DripQueue seen;
+  memset(&seen, 0, sizeof(seen));
+  seen.lastMode = MODE_NULL;
+  uint8_t got = 0;
+  bool ok = true;
+  dispatched = polls = 0;
+  auto dispatch = [&](const DripLine &l) {
+    dispatched++;
+    uint8_t k = dripClassify(seen, l.text);
+    if (k != DRIP_TRANSITION && k != DRIP_EDGE) return;
+    uint16_t state = ((uint16_t)(seen.lastMode + 1) << 12) | seen.lastSig;
+    if (got >= wantN || want[got] != state) ok = false;
+    got++;
+    currentMode = (Mode)seen.lastMode;
+  };
+
+  DripLine out;
+  for (uint8_t i = 0; i < n; i++) {
+    if (dripFull(q) && dripTake(q, out)) dispatch(out);
+    dripPush(q, lines[i], 0, 0, coalesce);
+  }
+  while (q.count) {
+    uint8_t budget = budgetPerPoll;
+    polls++;
+    while (dripPop(q, out, budget)) dispatch(out);
+  }
+  currentMode = savedMode;
+  return ok && got == wantN;
+}
+
+void benchDrip() {
+  // auto then teleop inside one poll; intake blips; score and climb pulses; checklist flicker
+  static const char *const autoToTeleop[] = {
+    "0 1,1,1,1", "1", "2 0,0,0,0", "2 1,0,0,0", "2 1,0,0,0", "2 1,1,0,0",
+  };
+  static const char *const intakeBlip[] = {
+    "2 1,0,0,0", "2 1,0,0,0", "2 1,1,0,0", "2 1,0,0,0", "2 1,0,0,0",
+    "2 1,0,0,0", "2 1,1,0,0", "2 0,1,0,0", "2 0,0,0,0", "2 0,0,0,0",
+  };
+  static const char *const scoreClimb[] = {
+    "2 0,0,0,0", "2 0,0,2,0", "2 0,0,2,0", "2 0,0,0,0", "2 0,0,0,3",
+    "2 0,0,0,3", "2 0,0,0,0", "3", "3", "0 1,0,1,1",
+  };
+  static const char *const checklistFlicker[] = {
+    "0 1,1,1,1", "0 1,1,0,1", "0 1,1,1,1", "0 1,1,1,1", "0 1,1,1,1",
+    "0 1,1,1,0", "0 1,1,1,0", "0 1,1,1,0", "0 1,1,1,0", "0 1,1,1,1",
+    "0 1,1,1,1", "0 1,1,1,1",
+  };
+  struct Burst { const char *name; const char *const *lines; uint8_t n; };
+  static const Burst bursts[] = {
+    { "auto->teleop", autoToTeleop, sizeof(autoToTeleop) / sizeof(autoToTeleop[0]) },
+    { "intake blip", intakeBlip, sizeof(intakeBlip) / sizeof(intakeBlip[0]) },
+    { "score/climb", scoreClimb, sizeof(scoreClimb) / sizeof(scoreClimb[0]) },
+    { "checklist", checklistFlicker, sizeof(checklistFlicker) / sizeof(checklistFlicker[0]) },
+  };
+
+  Serial.println("drip replay (lines in -> dispatched / polls, light | heavy load):");
+  bool allOk = true;
+  for (uint8_t b = 0; b < sizeof(bursts) / sizeof(bursts[0]); b++) {
+    uint8_t d0, p0, d1, p1;
+    bool ok0 = replayBurst(bursts[b].lines, bursts[b].n, false, DRIP_QUEUE_LEN, d0, p0);
+    bool ok1 = replayBurst(bursts[b].lines, bursts[b].n, true, 1, d1, p1);
+    allOk = allOk && ok0 && ok1;
+    Serial.print("  ");
+    Serial.print(bursts[b].name);
+    Serial.print(": ");
+    Serial.print(bursts[b].n);
+    Serial.print(" -> ");
+    Serial.print(d0);
+    Serial.print("/");
+    Serial.print(p0);
+    Serial.print(" | ");
+    Serial.print(d1);
+    Serial.print("/");
+    Serial.print(p1);
+    Serial.println((ok0 && ok1) ? "  ok" : "  LOST TRANSITION");
+  }
+  Serial.print("load: ");
+  Serial.print(costEma8 / 8);
+  Serial.print(" us/frame, ");
+  Serial.println(heavy ? "coalescing" : "in order");
+  Serial.println(allOk ? "all transitions and edges preserved" : "FAIL");
+}
@@ -13,6 +13,16 @@
 #include <string.h>       // for strlen(), snprintf()
 #include <stdio.h>        // for snprintf()
 #include "src/helpers.h"  // hsvToRgb helper for dynamic colours
+#include "src/sprite.h"
+#include "src/sprite_assets.h"
+#include "src/anim.h"
+#include "src/anim_assets.h"
+#include "src/text.h"
+#include "src/profiler.h"
+#include "src/log.h"
+#include "src/journal.h"
+#include "src/clock.h"
+#include "src/arena.h"
 
 // intake tube state (private to dynamic.cpp)
 static bool tubeActive = false;
@@ -30,10 +40,10 @@ static unsigned long scoreLastUpdate = 0;            // last update time for bar
 // meter height in pixels; bars extend down from baseline by up to this amount
 static const uint8_t scoreMeterHeight = 8;
 
-static float nodePosX[12];
-static float nodePosY[12];
-static float nodeVelX[12];
-static float nodeVelY[12];
+static float *const nodePosX = arena.dynamic.posX;   // node state lives in the mode arena
+static float *const nodePosY = arena.dynamic.posY;
+static float *const nodeVelX = arena.dynamic.velX;
+static float *const nodeVelY = arena.dynamic.velY;
 
 // scoring number animation state for overlay; counts down from start to target level
 static bool scoreNumberAnimating = false;
@@ -49,8 +59,12 @@ static uint8_t lastScoreLevel = 0;
 // climb state: 0=no climb, 1=ready, 2=attempt, 3=success
 static uint8_t dynClimbState = 0;
 
+// climb success celebration: streamed animation over the top segment while climb==3
+static AnimPlayer climbAnim;
+static bool climbCelebrating = false;
+
 // updateScoreBars: compute new bar heights based on current score level; simple random walk
-static void updateScoreBars() {
+void updateScoreBars() {
   if (dynScoreLevel == 0) return;
   float baseFraction = (float)dynScoreLevel / 4.0f;
   int baseHeight = (int)roundf(baseFraction * (float)scoreMeterHeight);
@@ -110,8 +124,8 @@ static void initNet() {
 }
 
 // segIntersect: return true if two line segments intersect
-static bool segIntersect(int x1, int y1, int x2, int y2,
-                         int x3, int y3, int x4, int y4) {
+bool segIntersect(int x1, int y1, int x2, int y2,
+                  int x3, int y3, int x4, int y4) {
   auto orient = [](long ax, long ay, long bx, long by, long cx, long cy) {
     long v = (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
     if (v > 0) return 1;
@@ -128,6 +142,7 @@ static bool segIntersect(int x1, int y1, int x2, int y2,
 
 // drawNet: update node positions, handle collisions, draw k-NN graph without crossings
 static void drawNet() {
+  PROFILE_SCOPE("drawNet");
   // rail lines separating segments
   const uint16_t rail = matrix.color565(0, 255, 0);
   matrix.drawLine(0, SEG_TOP_H, matrix.width() - 1, SEG_TOP_H, rail);
@@ -309,7 +324,7 @@ static void drawNet() {
     int ax = nodes[chosen[i].a].x, ay = nodes[chosen[i].a].y;
     int bx = nodes[chosen[i].b].x, by = nodes[chosen[i].b].y;
     // Compute a phase for this edge, varying with time and index.
-    float phase = ((float)millis() / 120.0f) + (float)i * 0.3f;
+    float phase = ((float)clockMillis() / 120.0f) + (float)i * 0.3f;
     float t = (sinf(phase) + 1.0f) * 0.5f;  // 0→1
     // Blend between green (0,255,0) and white (255,255,255)
     uint8_t rE = (uint8_t)(t * 255.0f);
@@ -322,7 +337,7 @@ static void drawNet() {
   for (uint8_t i = 0; i < NODE_COUNT; i++) {
     // Colour varies with time and node index.  The node pulses through
     // shades of green→white.
-    float phaseC = ((float)millis() / 100.0f) + (float)i * 0.5f;
+    float phaseC = ((float)clockMillis() / 100.0f) + (float)i * 0.5f;
     float tc = (sinf(phaseC) + 1.0f) * 0.5f;
     uint8_t rN = (uint8_t)(tc * 255.0f);
     uint8_t gN = 255;
@@ -330,7 +345,7 @@ static void drawNet() {
     uint16_t colN = matrix.color565(rN, gN, bN);
     // Pulse radius between 1 and 2 pixels based on a sinusoid.  Each
     // node pulses at a slightly different phase by adding its index.
-    float phaseR = ((float)millis() / 200.0f) + (float)i;
+    float phaseR = ((float)clockMillis() / 200.0f) + (float)i;
     float s = sinf(phaseR);
     uint8_t rad = (uint8_t)(1 + (s > 0.0f ? 1 : 0));
     matrix.fillCircle(nodes[i].x, nodes[i].y, rad, colN);
@@ -338,9 +353,9 @@ static void drawNet() {
 }
 
 // rotProj: rotate a 3D vector by roll/pitch and project to screen coords
-static void rotProj(const float in[3], float pitch, float roll,
-                    int16_t& sx, int16_t& sy,
-                    int16_t cx, int16_t cy) {
+void rotProj(const float in[3], float pitch, float roll,
+             int16_t& sx, int16_t& sy,
+             int16_t cx, int16_t cy) {
   float x = in[0] * CUBE_SIZE;
   float y = in[1] * CUBE_SIZE;
   float z = in[2] * CUBE_SIZE;
@@ -382,16 +397,34 @@ static void drawTinyCube(int16_t x0, int16_t y0) {
   }
 }
 
-// initDynamic: init LIS3DH, seed net, reset filters and UI flags
-void initDynamic() {
+// dynamicSensorBegin: start i2c and probe the LIS3DH, once per boot
+void dynamicSensorBegin() {
+  static bool probed = false;
+  if (probed) return;
+  probed = true;
   Wire.begin();
   if (!lis.begin(0x18) && !lis.begin(0x19)) {
-    Serial.println(F("LIS3DH not found at 0x18 or 0x19"));
+    LOG_ERROR("LIS3DH not found at 0x18 or 0x19");
   } else {
     lis.setRange(LIS3DH_RANGE_4_G);
   }
+}
+
+// the last payload applied, so a repeat of it leaves running animations alone
+static Message lastDynMsg;
+static bool    haveLastDynMsg = false;
+
+// initDynamic: init LIS3DH (unless pre-warmed), seed net, reset filters and UI flags
+void initDynamic() {
+  arenaClaim(ARENA_DYNAMIC);
+  haveLastDynMsg = false;   // a fresh start applies the next payload even if it is a repeat
+  dynamicSensorBegin();
   initNet();
 
+  // a celebration left over from the last run is started again by the next climb=3
+  animStop(climbAnim);
+  climbCelebrating = false;
+
   filtRoll = 0.0f;
   filtPitch = 0.0f;
   accX = accY = accZ = 0.0f;
@@ -400,61 +433,42 @@ void initDynamic() {
   showCube = false;
 
   dynAiState = false;
-  dynAiPrev = millis();
+  dynAiPrev = clockMillis();
   dynReqState = false;
-  dynReqPrev = millis();
+  dynReqPrev = clockMillis();
 
   // intake flags
   dynHasPiece = false;
   dynHasBlink = false;
-  dynHasPrev = millis();
+  dynHasPrev = clockMillis();
   dynReqTextVisible = true;  // banners visible until tube completes
 }
 
-// updateDynamicFromPayload: parse req,intake,score,climb flags and update UI states
-void updateDynamicFromPayload(const char* payload) {
-  int v[4] = { 0, 0, 0, 0 };
+// updateDynamicFromMessage: apply parsed req,intake,score,climb flags (or legacy accel,ai,cube) and update UI states
+void updateDynamicFromMessage(const Message &msg) {
   static bool lastHas = false;
 
-  // track the last received payload string to avoid re-triggering
-  // animations or resetting state when the same message arrives
-  static char lastPayloadStr[32] = "";
-  if (payload && payload[0] != '\0' && lastPayloadStr[0] != '\0') {
-    if (strcmp(payload, lastPayloadStr) == 0) {
-      // identical payload received again; do nothing to preserve
-      // current state/animation
-      return;
-    }
-  }
-  // copy the new payload into lastPayloadStr for next comparison
-  if (payload && payload[0] != '\0') {
-    strncpy(lastPayloadStr, payload, sizeof(lastPayloadStr) - 1);
-    lastPayloadStr[sizeof(lastPayloadStr) - 1] = '\0';
+  if (msg.format == PAYLOAD_NONE) return;
+  if (haveLastDynMsg && messageEqual(msg, lastDynMsg)) {
+    // identical payload received again; do nothing to preserve
+    // current state/animation
+    return;
   }
-  int count = 0;
-  if (payload && *payload) {
-    char tmp[24];
-    strncpy(tmp, payload, sizeof(tmp) - 1);
-    tmp[sizeof(tmp) - 1] = '\0';
-    char* p = tmp;
-    // parse up to 4 comma‑separated integers.  Track how many
-    // successfully converted tokens we see to distinguish between
-    // legacy 3‑flag messages and the new 4‑flag format.
-    for (uint8_t i = 0; i < 4; i++) {
-      v[i] = atoi(p);
-      count++;
-      char* c = strchr(p, ',');
-      if (!c) break;
-      p = c + 1;
-    }
+  lastDynMsg = msg;
+  haveLastDynMsg = true;
+  if (msg.format == PAYLOAD_DYNAMIC) {
+    const DynamicMsg &d = msg.payload.dynamic;
+    journalEvent(JEV_DYNAMIC, d.req | d.intake << 1, d.score, d.climb);
+  } else {
+    const DynamicLegacyMsg &l = msg.payload.legacy;
+    journalEvent(JEV_LEGACY, l.accel | l.ai << 1 | l.cube << 2);
   }
 
-  bool isNewFormat = (count > 3);
-
-  if (isNewFormat) {
+  if (msg.format == PAYLOAD_DYNAMIC) {
+    const DynamicMsg &d = msg.payload.dynamic;
     // new format: request flag
-    bool reqFlag = (v[0] != 0);
-    int score = v[2];
+    bool reqFlag = (d.req != 0);
+    int score = d.score;
 
     if (score > 0) {
 
@@ -463,7 +477,7 @@ void updateDynamicFromPayload(const char* payload) {
 
       if (!scoreNumberAnimating || dynScoreLevel != lastScoreLevel) {
         scoreNumberAnimating = true;
-        scoreNumberStart = millis();
+        scoreNumberStart = clockMillis();
 
         scoreNumberStartVal = 50;
         scoreNumberTargetVal = dynScoreLevel;
@@ -487,20 +501,17 @@ void updateDynamicFromPayload(const char* payload) {
       // request flag
       dynReqPiece = reqFlag;
       // intake flag with edge-detection for tube animation
-      bool newHas = (v[1] != 0);
+      bool newHas = (d.intake != 0);
       if (newHas && !lastHas) {
         // rising edge → start tube
         tubeActive = true;
         tubeFinished = false;
         dynReqTextVisible = true;  // visible during tube travel (then we hide)
-        // tube geometry (aligned to top banner)
-        const int16_t pad = 2;
-        const int16_t h = CHAR_H + pad + 1;         // per-line height
-        const int16_t wBox = 5 * CHAR_W + pad * 2;  // banner width
-        tubeW = wBox;
+        // tube geometry comes from the piece sprite (banner width, half screen tall)
+        tubeW = spritePieceTube.w;
         tubeX = (matrix.width() - tubeW) / 2;
 
-        tubeBodyH = matrix.height() / 2;
+        tubeBodyH = spritePieceTube.h;
         // Start fully above the visible area with a small margin
         tubeY = -tubeBodyH - 4;
         // Slower slide speed for readability
@@ -516,19 +527,20 @@ void updateDynamicFromPayload(const char* payload) {
       lastHas = newHas;
       dynHasPiece = newHas;
     }
-    // climb state (v[3])
-    dynClimbState = (uint8_t)v[3];
+    // climb state
+    dynClimbState = d.climb;
   } else {
-    // legacy format: treat v[0],v[1],v[2] as accel/ai/cube toggles
+    // legacy format: accel/ai/cube toggles
+    const DynamicLegacyMsg &l = msg.payload.legacy;
     dynScoreActive = false;
     dynScoreLevel = 0;
     // update optional flags; fallback retains prior behaviour (no fetch)
     // showAccel enables accelerometer strip rendering (not implemented)
-    showAccel = (v[0] != 0);
+    showAccel = (l.accel != 0);
     // showAI placeholder (unused)
-    showAI = (v[1] != 0);
+    showAI = (l.ai != 0);
     // showCube toggles the 3D cube preview on the right
-    showCube = (v[2] != 0);
+    showCube = (l.cube != 0);
     // ensure request/intake state cleared when legacy flags are used
     dynReqPiece = false;
     dynHasPiece = false;
@@ -566,7 +578,7 @@ void runDynamicFrame() {
   filtPitch = filtPitch * (1.0f - SMOOTHING) + pitchRaw * SMOOTHING;
 
   // blinks
-  unsigned long now = millis();
+  unsigned long now = clockMillis();
   if (now - dynAiPrev >= dynAiInterval) {
     dynAiPrev = now;
     dynAiState = !dynAiState;
@@ -580,7 +592,20 @@ void runDynamicFrame() {
     dynHasBlink = !dynHasBlink;
   }
 
-  matrix.fillScreen(0);
+  // climb success plays a delta-coded animation in the top segment; it owns
+  // those pixels between frames, so only clear the rest of the screen
+  bool celebrate = (dynClimbState == 3) && !(dynScoreActive && dynScoreLevel > 0);
+  if (celebrate && !climbCelebrating) {
+    animStart(climbAnim, animFlashSource(animClimbBurst, animClimbBurstSize), 0, 0);
+  } else if (!celebrate && climbCelebrating) {
+    animStop(climbAnim);
+  }
+  climbCelebrating = celebrate;
+  if (climbCelebrating) {
+    matrix.fillRect(0, climbAnim.h, matrix.width(), matrix.height() - climbAnim.h, 0);
+  } else {
+    matrix.fillScreen(0);
+  }
 
   // network (always)
   drawNet();
@@ -598,7 +623,7 @@ void runDynamicFrame() {
 
   if (dynScoreActive && dynScoreLevel > 0) {
     // periodically update the bar amplitudes
-    unsigned long nowScore = millis();
+    unsigned long nowScore = clockMillis();
 
     if (nowScore - scoreLastUpdate > 10UL) {
       scoreLastUpdate = nowScore;
@@ -608,7 +633,7 @@ void runDynamicFrame() {
     // update the animated number
     int displayVal;
     if (scoreNumberAnimating) {
-      unsigned long elapsed = millis() - scoreNumberStart;
+      unsigned long elapsed = clockMillis() - scoreNumberStart;
       float t = (float)elapsed / (float)scoreAnimDuration;
       if (t >= 1.0f) {
         scoreNumberAnimating = false;
@@ -705,9 +730,8 @@ void runDynamicFrame() {
     snprintf(numBuf, sizeof(numBuf), "%d", displayVal);
     size_t numLen = strlen(numBuf);
 
-    // Set text colour once
+    // label and number colour
     uint16_t txtCol = matrix.color565(255, 255, 255);
-    matrix.setTextColor(txtCol);
 
     // Determine heights for the label line (size 1) and the number line
     // (size 2).  The TomThumb font height is CHAR_H.  With
@@ -728,14 +752,8 @@ void runDynamicFrame() {
     int16_t lvlX = (matrix.width() - (5 * CHAR_W)) / 2;
     int16_t numX = (matrix.width() - (int)(numLen * CHAR_W * 2)) / 2;
     // Draw top text
-    matrix.setTextSize(1);
-    matrix.setCursor(lvlX, yLevelTop);
-    matrix.print(Lbl);
-    matrix.setTextSize(2);
-    matrix.setCursor(numX, yNumTop);
-    matrix.print(numBuf);
-    // Reset to size 1 after drawing number
-    matrix.setTextSize(1);
+    textDrawLabel(lvlX, yLevelTop, Lbl, txtCol);
+    textDraw(numX, yNumTop, numBuf, txtCol, 2);
 
     // Bottom segment: compute analogous positions
     int16_t yMidBot = bottomSegY + bottomSegH / 2;
@@ -744,13 +762,8 @@ void runDynamicFrame() {
     int16_t yNumBot = yBlockBot + hLbl + (hNum - (CHAR_H * 2)) / 2;
     lvlX = (matrix.width() - (5 * CHAR_W)) / 2;
     numX = (matrix.width() - (int)(numLen * CHAR_W * 2)) / 2;
-    matrix.setTextSize(1);
-    matrix.setCursor(lvlX, yLevelBot);
-    matrix.print(Lbl);
-    matrix.setTextSize(2);
-    matrix.setCursor(numX, yNumBot);
-    matrix.print(numBuf);
-    matrix.setTextSize(1);
+    textDrawLabel(lvlX, yLevelBot, Lbl, txtCol);
+    textDraw(numX, yNumBot, numBuf, txtCol, 2);
 
   } else if (dynClimbState > 0) {
 
@@ -772,42 +785,14 @@ void runDynamicFrame() {
       int16_t yBoxes = yStart + h + climbGap;
       // draw according to climbState
       if (dynClimbState == 3) {
-        // success: flashing "WHAT", "A", "CLIMB".  Use the dynHasBlink
-        // flag to blink text at roughly 2× request blink speed.
-        bool visible = dynHasBlink;
-        if (visible) {
-          matrix.setTextColor(greenCol);
-          // centre each line horizontally
-          const char* w1 = "WHAT";
-          const char* w2 = "A";
-          const char* w3 = "CLIMB";
-          size_t l1 = strlen(w1);
-          size_t l2 = strlen(w2);
-          size_t l3 = strlen(w3);
-          int16_t x1 = (matrix.width() - (l1 * CHAR_W)) / 2;
-          int16_t x2 = (matrix.width() - (l2 * CHAR_W)) / 2;
-          int16_t x3 = (matrix.width() - (l3 * CHAR_W)) / 2;
-          // compute vertical positions for three lines within the top segment
-          int16_t totalTextH = h * 3;
-          int16_t yMid = segY + segH / 2;
-          int16_t y0 = yMid - totalTextH / 2;
-          int16_t yLine1 = y0 + (h - CHAR_H) / 2;
-          int16_t yLine2 = y0 + h + (h - CHAR_H) / 2;
-          int16_t yLine3 = y0 + 2 * h + (h - CHAR_H) / 2;
-          matrix.setCursor(x1, yLine1);
-          matrix.print(w1);
-          matrix.setCursor(x2, yLine2);
-          matrix.print(w2);
-          matrix.setCursor(x3, yLine3);
-          matrix.print(w3);
-        }
+        // success: the celebration animation owns the top segment; decode
+        // whatever frames are due (the bottom segment keeps WHAT A CLIMB)
+        animUpdate(climbAnim);
       } else {
         // states 1 or 2: draw READY label and two boxes
-        matrix.setTextColor(matrix.color565(255, 255, 255));
         int16_t xReady = (matrix.width() - readyWidth) / 2;
         int16_t yReady = yLabel + (h - CHAR_H) / 2;
-        matrix.setCursor(xReady, yReady);
-        matrix.print("READY");
+        textDrawLabel(xReady, yReady, "READY", matrix.color565(255, 255, 255));
         // Determine box colour: state 1 = red; state 2 = flashing green
         uint16_t boxCol;
         if (dynClimbState == 1) {
@@ -815,7 +800,7 @@ void runDynamicFrame() {
         } else {
           // flash green at 4× AI blink frequency
           unsigned long interval = dynAiInterval / 4;
-          bool blink = ((millis() / (interval > 0 ? interval : 1)) % 2) == 0;
+          bool blink = ((clockMillis() / (interval > 0 ? interval : 1)) % 2) == 0;
           boxCol = blink ? greenCol : redCol;
         }
         // boxes horizontal layout
@@ -823,8 +808,8 @@ void runDynamicFrame() {
         int16_t totalBoxesW = chkBoxW * 2 + gapBoxes;
         int16_t xBoxes = (matrix.width() - totalBoxesW) / 2;
         // draw top boxes
-        matrix.fillRect(xBoxes, yBoxes, chkBoxW, chkBoxH, boxCol);
-        matrix.fillRect(xBoxes + chkBoxW + gapBoxes, yBoxes, chkBoxW, chkBoxH, boxCol);
+        blitSprite(spriteCheckBox, xBoxes, yBoxes, &boxCol);
+        blitSprite(spriteCheckBox, xBoxes + chkBoxW + gapBoxes, yBoxes, &boxCol);
       }
     }
     // Bottom segment: replicate the top segment layout
@@ -839,7 +824,6 @@ void runDynamicFrame() {
       if (dynClimbState == 3) {
         bool visible = dynHasBlink;
         if (visible) {
-          matrix.setTextColor(greenCol);
           const char* w1 = "WHAT";
           const char* w2 = "A";
           const char* w3 = "CLIMB";
@@ -855,32 +839,27 @@ void runDynamicFrame() {
           int16_t yLine1 = y0 + (h - CHAR_H) / 2;
           int16_t yLine2 = y0 + h + (h - CHAR_H) / 2;
           int16_t yLine3 = y0 + 2 * h + (h - CHAR_H) / 2;
-          matrix.setCursor(x1, yLine1);
-          matrix.print(w1);
-          matrix.setCursor(x2, yLine2);
-          matrix.print(w2);
-          matrix.setCursor(x3, yLine3);
-          matrix.print(w3);
+          textDrawLabel(x1, yLine1, w1, greenCol);
+          textDrawLabel(x2, yLine2, w2, greenCol);
+          textDrawLabel(x3, yLine3, w3, greenCol);
         }
       } else {
-        matrix.setTextColor(matrix.color565(255, 255, 255));
         int16_t xReady = (matrix.width() - readyWidth) / 2;
         int16_t yReady = yLabel + (h - CHAR_H) / 2;
-        matrix.setCursor(xReady, yReady);
-        matrix.print("READY");
+        textDrawLabel(xReady, yReady, "READY", matrix.color565(255, 255, 255));
         uint16_t boxCol;
         if (dynClimbState == 1) {
           boxCol = redCol;
         } else {
           unsigned long interval = dynAiInterval / 4;
-          bool blink = ((millis() / (interval > 0 ? interval : 1)) % 2) == 0;
+          bool blink = ((clockMillis() / (interval > 0 ? interval : 1)) % 2) == 0;
           boxCol = blink ? greenCol : redCol;
         }
         int16_t gapBoxes = 4;
         int16_t totalBoxesW = chkBoxW * 2 + gapBoxes;
         int16_t xBoxes = (matrix.width() - totalBoxesW) / 2;
-        matrix.fillRect(xBoxes, yBoxes, chkBoxW, chkBoxH, boxCol);
-        matrix.fillRect(xBoxes + chkBoxW + gapBoxes, yBoxes, chkBoxW, chkBoxH, boxCol);
+        blitSprite(spriteCheckBox, xBoxes, yBoxes, &boxCol);
+        blitSprite(spriteCheckBox, xBoxes + chkBoxW + gapBoxes, yBoxes, &boxCol);
       }
     }
 
@@ -894,30 +873,19 @@ void runDynamicFrame() {
     if (dynHasPiece) {
       // text-only, blinking green at 2× speed
       if (dynHasBlink || !tubeFinished) {
-        matrix.setTextColor(matrix.color565(0, 255, 0));
+        const uint16_t green = matrix.color565(0, 255, 0);
         // top two lines
-        matrix.setCursor(xCtr + pad, yTop + (h - CHAR_H) / 2);
-        matrix.print(W1);
-        matrix.setCursor(xCtr + pad, yTop + h + (h - CHAR_H) / 2);
-        matrix.print(W2);
+        textDrawLabel(xCtr + pad, yTop + (h - CHAR_H) / 2, W1, green);
+        textDrawLabel(xCtr + pad, yTop + h + (h - CHAR_H) / 2, W2, green);
         // bottom two lines
-        matrix.setCursor(xCtr + pad, yBot + (h - CHAR_H) / 2);
-        matrix.print(W1);
-        matrix.setCursor(xCtr + pad, yBot + h + (h - CHAR_H) / 2);
-        matrix.print(W2);
+        textDrawLabel(xCtr + pad, yBot + (h - CHAR_H) / 2, W1, green);
+        textDrawLabel(xCtr + pad, yBot + h + (h - CHAR_H) / 2, W2, green);
       }
 
       // tube slide-in from top over the top banner
       if (tubeActive) {
-        // body
-        uint16_t white = matrix.color565(255, 255, 255);
-        matrix.fillRect(tubeX, tubeY, tubeW, tubeBodyH, white);
-
-        // “rim” near the front (simulate a pipe mouth)
-        int rimH = 4;
-        int ry = tubeY + tubeBodyH - rimH;
-        matrix.drawRect(tubeX, ry, tubeW, rimH, white);
-        matrix.fillRect(tubeX + 1, ry + 1, tubeW - 2, rimH - 2, 0);
+        // body and pipe-mouth rim (piece top view sprite)
+        blitSprite(spritePieceTube, tubeX, tubeY);
 
         // advance: slide until the bottom of the tube reaches the network
         // boundary defined by SEG_TOP_H.  Once the bottom is past that
@@ -933,12 +901,7 @@ void runDynamicFrame() {
         // Keep the tube in place after it has finished sliding in until
         // dynHasPiece becomes false.  Draw the tube body and rim at its
         // final position.
-        uint16_t white = matrix.color565(255, 255, 255);
-        matrix.fillRect(tubeX, tubeY, tubeW, tubeBodyH, white);
-        int rimH = 4;
-        int ry = tubeY + tubeBodyH - rimH;
-        matrix.drawRect(tubeX, ry, tubeW, rimH, white);
-        matrix.fillRect(tubeX + 1, ry + 1, tubeW - 2, rimH - 2, 0);
+        blitSprite(spritePieceTube, tubeX, tubeY);
       }
     } else if (dynReqPiece) {
       // normal request (boxes that color-swap)
@@ -948,23 +911,15 @@ void runDynamicFrame() {
 
         // top: FETCH / PIECE
         matrix.fillRect(xCtr, yTop, wBox, h, bg);
-        matrix.setTextColor(tx);
-        matrix.setCursor(xCtr + pad, yTop + (h - CHAR_H) / 2);
-        matrix.print(W1);
+        textDrawLabel(xCtr + pad, yTop + (h - CHAR_H) / 2, W1, tx);
         matrix.fillRect(xCtr, yTop + h, wBox, h, bg);
-        matrix.setTextColor(tx);
-        matrix.setCursor(xCtr + pad, yTop + h + (h - CHAR_H) / 2);
-        matrix.print(W2);
+        textDrawLabel(xCtr + pad, yTop + h + (h - CHAR_H) / 2, W2, tx);
 
         // bottom: FETCH / PIECE
         matrix.fillRect(xCtr, yBot, wBox, h, bg);
-        matrix.setTextColor(tx);
-        matrix.setCursor(xCtr + pad, yBot + (h - CHAR_H) / 2);
-        matrix.print(W1);
+        textDrawLabel(xCtr + pad, yBot + (h - CHAR_H) / 2, W1, tx);
         matrix.fillRect(xCtr, yBot + h, wBox, h, bg);
-        matrix.setTextColor(tx);
-        matrix.setCursor(xCtr + pad, yBot + h + (h - CHAR_H) / 2);
-        matrix.print(W2);
+        textDrawLabel(xCtr + pad, yBot + h + (h - CHAR_H) / 2, W2, tx);
       }
     } else {
       // neither requested nor in intake -> ensure tube state cleared
@@ -990,14 +945,10 @@ void runDynamicFrame() {
     uint16_t bTx = dynAiState ? colY : colR;
 
     matrix.fillRect(x0, yb, wBoxAI, hAI, aBg);
-    matrix.setTextColor(aTx);
-    matrix.setCursor(x0 + pad, yb + (hAI - CHAR_H) / 2);
-    matrix.print("AI");
+    textDrawLabel(x0 + pad, yb + (hAI - CHAR_H) / 2, "AI", aTx);
 
     matrix.fillRect(x1, yb, wBoxAI, hAI, bBg);
-    matrix.setTextColor(bTx);
-    matrix.setCursor(x1 + pad, yb + (hAI - CHAR_H) / 2);
-    matrix.print("ON");
+    textDrawLabel(x1 + pad, yb + (hAI - CHAR_H) / 2, "ON", bTx);
   }
 
   if (showCube && !(dynScoreActive && dynScoreLevel > 0)) {
@@ -1006,3 +957,8 @@ void runDynamicFrame() {
 
   matrix.show();
 }
+
+// reportDynamicAnim: stats for the climb celebration player
+void reportDynamicAnim() {
+  animReport(climbAnim, "climb anim");
+}
@@ -2,6 +2,7 @@
 
 #include "src/globals.h"
 #include "src/matrix_config.h"
+#include "src/arena.h"
 #include "arduinoFFT.h"
 #include <Arduino.h>
 #include <math.h>
@@ -15,8 +16,7 @@ Mode lastMode    = MODE_NULL;
 const int16_t SEG_TOP_H   = 48;
 const int16_t SEG_MID_H   = 32;
 const int16_t SEG_BOT_H   = 48;
-const uint8_t NODE_COUNT  = 12;
-Node       nodes[NODE_COUNT];
+Node *const nodes        = arena.dynamic.nodes;
 uint8_t    netFrame       = 0;
 Adafruit_LIS3DH lis;
 const float SMOOTHING       = 0.2f;
@@ -72,10 +72,10 @@ bool    perryActive   = false;
 int     lastSponsor   = -1;
 const char* perryLines4[]    = { "Perry","The","Peri-","Scope" };
 const uint8_t perryLineCount4 = 4;
-uint8_t      perryLens4[4]    = {0};
-bool         perryDec[4][16]  = {{false}};
-uint8_t      perryDone[4]     = {0};
-uint8_t      perryWriteIdx4[4]= {0};
+uint8_t *const perryLens4     = arena.perry.lens;
+bool   (*const perryDec)[16]  = arena.perry.dec;
+uint8_t *const perryDone      = arena.perry.done;
+uint8_t *const perryWriteIdx4 = arena.perry.writeIdx;
 unsigned long p_lastUpdate=0, p_lastObf=0, p_startObf=0, p_finalHold=0;
 bool    p_writing   = true;
 bool    p_decrypting= false;
@@ -84,42 +84,42 @@ int16_t p_yStart    = 0;
 int16_t p_lineGap   = 0;
 
 // audio visualizer state: FFT, audio flags, timing, sample buffers, bar metrics, peaks and smoothing
-ArduinoFFT<double> FFT(vReal, vImag, samples, samplingFrequency);
+ArduinoFFT<float> FFT(vReal, vImag, samples, samplingFrequency);
 bool        audioActive      = false;
 unsigned long audioStartTime= 0;
-const unsigned long audioDuration = 15000UL;
-const uint16_t samples         = 256;
+unsigned long audioDuration = 15000UL;
+const uint16_t samples         = FFT_SAMPLES;
 const double   samplingFrequency = 16000.0;
 const unsigned long sampleDelay  = 1000000UL/samplingFrequency;
-double      vReal[samples]       = {0}, vImag[samples] = {0};
+float *const vReal               = arena.audio.vReal;
+float *const vImag               = arena.audio.vImag;
 int         barHeights[WIDTH/3]  = {0};
 bool        redlined[WIDTH/3]    = {false};
 int         peakLevels[WIDTH/3]  = {0};
 unsigned long peakTimes[WIDTH/3] = {0};
-const int   smoothingFactor      = 4;
-double      smoothedInput[samples] = {0};
+int         smoothingFactor      = 4;
+float *const smoothedInput       = arena.audio.smoothedInput;
 const int   WAVE_X_SHIFT         = 0;
 
 // timing and layout constants for boot screens, animations and spacing
 const unsigned long bootDelay            = 1000;
 const unsigned long dashDelayBefore      = 1000;
 const unsigned long dashedPhaseDuration = 500;
-const unsigned long typeDelay            = 100;
+unsigned long typeDelay                  = 100;
 const unsigned long postOptionsDelay     = 2000;
 const unsigned long flashDelay           = 100;
 const uint8_t     flashCount            = 6;
 const unsigned long hueCycleDuration    = 2000;
 const unsigned long postChecklistDelay  = 500;
-const unsigned long boxDelay            = 200;
+unsigned long boxDelay                  = 200;
 const uint16_t animDelayP   = 80;
 const uint16_t obfSpeedP    = 50;
 const uint16_t obfDurationP = 5000;
 const uint16_t pauseP       = 1000;
 const uint16_t loadDurP     = 3000;
 const uint16_t writeDelayP  = 100;
-const int       SCROLL_SPEED = 1;
-const int       FRAME_DELAY  = 5;
-const uint8_t   HUE_DELTA    = 8;
+int             scrollSpeed  = 1;
+uint8_t         hueDelta     = 8;
 const uint8_t   SEP_Y        = 17;
 const uint8_t   topSpacing   = 4;
 const uint8_t   betweenSetupAndPiece = 2;
@@ -132,8 +132,6 @@ const uint8_t   chkBoxH      = 8;
 // autonomous mode data: timers, intervals, state flags, display text and positions
 unsigned long autoTextPrev      = 0;
 unsigned long textInterval      = 325;
-unsigned long autoStarPrev      = 0;
-unsigned long starInterval      = 40;
 unsigned long startTime         = 0;
 unsigned long animationDuration = 120000;
 bool   autoState                = false;
@@ -142,8 +140,8 @@ const char* line1               = "AUTO";
 const char* line2               = "LOCK";
 int16_t tX1=0, tX2=0, tY1=0, tY2=0, boxX=0, boxY=0, boxW=0, boxH=0;
 
-// starfield: preallocate stars array and dynamic circle radii
-Star    stars[MAX_STARS]       = {};
+// starfield: stars (in the mode arena) and dynamic circle radii
+Star *const stars              = arena.autonomous.stars;
 const int DYN_CIRCLES          = 2;
 int       dynRadius[DYN_CIRCLES] = {0};
 const int maxDynRadius         = 50;
@@ -170,12 +168,12 @@ uint16_t     dynAiInterval  = 325;     // ms
 char lineBuf[64] = {};
 
 /*
- * When dripFeedMode is enabled, incoming serial messages are handled in
- * a last‑one‑wins fashion.  Multiple updates received in a single
- * iteration of handleRobotMessage() or readAndProcess() will have
- * earlier lines dropped in favour of the most recent complete
- * message.  This reduces backlog when sensors oscillate rapidly
- * between states.  Set to true by default; may be toggled at runtime
- * via Serial commands if desired.
+ * When dripFeedMode is enabled, incoming serial messages are queued per
+ * source and drained a few per call of handleRobotMessage().  While
+ * frames are slow, a run of level updates within one mode collapses to
+ * the most recent line; mode changes and edge events are always kept,
+ * in order (see drip.cpp).  This reduces backlog when sensors oscillate
+ * rapidly between states.  Set to true by default; toggle it at runtime
+ * with "?set dripFeedMode 0" (params.cpp).
  */
 bool dripFeedMode = true;
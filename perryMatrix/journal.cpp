@@ -0,0 +1,256 @@
+// © 2025 SC5K Systems
+
+#include "src/journal.h"
+#include "src/storage.h"
+#include "src/log.h"
+#include "src/clock.h"
+#include <Arduino.h>
+#include <string.h>
+#include <stdio.h>
+
+static_assert(sizeof(JournalEvent) == 8, "journal records are 8 bytes");
+static_assert(JOURNAL_PAGE_SIZE % sizeof(JournalEvent) == 0 && JOURNAL_RING_SIZE % sizeof(JournalEvent) == 0,
+              "records must never straddle a page or the ring end");
+static_assert((JOURNAL_RING_SIZE & (JOURNAL_RING_SIZE - 1)) == 0, "JOURNAL_RING_SIZE must be a power of two");
+
+// ---- state ----
+// events wait in 'ring' until journalFrame programs them; head/tail run free like log.cpp
+static uint8_t  ring[JOURNAL_RING_SIZE];
+static uint16_t head = 0, tail = 0;
+static unsigned long oldestMs = 0;   // when the oldest unwritten event was queued
+
+static bool     ready = false;
+static bool     suspended = false;   // journalSuspend: events are dropped, not lost
+static uint16_t sector = 0;          // sector being filled
+static uint32_t seq = 0;             // its sequence number
+static uint16_t offset = 0;          // next free byte in it; 0 = header not written yet
+static bool     erased = false;      // 'sector' has been erased for this pass of the ring
+
+static unsigned long lastFrameMs = 0;
+static uint32_t lost = 0, erases = 0, programs = 0, bytesWritten = 0, busySkips = 0;
+static unsigned long maxServiceUs = 0;
+
+void journalInit() {
+  ready = JOURNAL_ENABLED && storageBegin();
+  if (!ready) {
+    LOG_WARN("journal: no flash, events not recorded");
+    return;
+  }
+  // the sector with the highest sequence number is the newest; start after it
+  bool found = false;
+  uint32_t best = 0;
+  uint16_t newest = 0;
+  for (uint16_t s = 0; s < JOURNAL_SECTORS; s++) {
+    JournalEvent h;
+    storageRead((uint32_t)s * JOURNAL_SECTOR_SIZE, (uint8_t *)&h, sizeof(h));
+    if (h.type != JEV_SECTOR) continue;
+    if (!found || (int32_t)(h.ms - best) > 0) {
+      best = h.ms;
+      newest = s;
+      found = true;
+    }
+  }
+  sector = found ? (newest + 1) % JOURNAL_SECTORS : 0;
+  seq    = found ? best + 1 : 1;
+  offset = 0;
+  erased = false;
+  journalEvent(JEV_BOOT);
+}
+
+void journalSuspend(bool on) {
+  suspended = on;
+}
+
+void journalEvent(uint8_t type, uint8_t a, uint8_t b, uint8_t c) {
+  if (!ready || suspended) return;
+  if ((uint16_t)(head - tail) + sizeof(JournalEvent) > JOURNAL_RING_SIZE) {
+    lost++;
+    return;
+  }
+  if (head == tail) oldestMs = clockMillis();
+  JournalEvent e = { (uint32_t)clockMillis(), type, a, b, c };
+  memcpy(ring + (head & (JOURNAL_RING_SIZE - 1)), &e, sizeof(e));
+  head += sizeof(e);
+}
+
+// service: one flash operation at most: erase, sector header, or a page worth of events
+static void service() {
+  if (storageBusy()) {
+    busySkips++;
+    return;
+  }
+  unsigned long t0 = micros();
+  uint32_t base = (uint32_t)sector * JOURNAL_SECTOR_SIZE;
+  if (offset == 0) {
+    if (!erased) {
+      // the chip erases on its own from here; later passes see it busy and leave it be
+      storageErase(sector);
+      erases++;
+      erased = true;
+    } else {
+      JournalEvent h = { seq, JEV_SECTOR, 0, 0, 0 };
+      storageProgram(base, (const uint8_t *)&h, sizeof(h));
+      programs++;
+      bytesWritten += sizeof(h);
+      offset = sizeof(h);
+    }
+  } else {
+    uint16_t pending = head - tail;
+    if (!pending) return;
+    uint16_t room = JOURNAL_PAGE_SIZE - (offset % JOURNAL_PAGE_SIZE);
+    // wait for a full page unless events have been sitting too long
+    if (pending < room && clockMillis() - oldestMs < JOURNAL_FLUSH_MS) return;
+    uint16_t n = min(pending, room);
+    // stop at the ring end too; the rest goes out on the next pass
+    n = min(n, (uint16_t)(JOURNAL_RING_SIZE - (tail & (JOURNAL_RING_SIZE - 1))));
+    storageProgram(base + offset, ring + (tail & (JOURNAL_RING_SIZE - 1)), n);
+    programs++;
+    bytesWritten += n;
+    tail += n;
+    offset += n;
+    if (head != tail) oldestMs = clockMillis();
+    if (offset >= JOURNAL_SECTOR_SIZE) {
+      sector = (sector + 1) % JOURNAL_SECTORS;
+      seq++;
+      offset = 0;
+      erased = false;
+    }
+  }
+  unsigned long us = micros() - t0;
+  if (us > maxServiceUs) maxServiceUs = us;
+}
+
+void journalFrame(Mode mode) {
+  if (!ready) return;
+  unsigned long now = clockMillis();
+  if (lastFrameMs) {
+    unsigned long pass = now - lastFrameMs;
+    if (pass > JOURNAL_OVERRUN_MS) {
+      uint16_t ms = pass > 0xFFFF ? 0xFFFF : (uint16_t)pass;
+      journalEvent(JEV_OVERRUN, ms & 0xFF, ms >> 8, (uint8_t)mode);
+    }
+  }
+  lastFrameMs = now;
+  service();
+}
+
+// printEvent: one record as a line of text
+static void printEvent(const JournalEvent &e) {
+  static const char *const sources[] = { "USB", "Serial1" };
+  static const char *const reasons[] = { "overflow", "coalesced" };
+  char line[64];
+  switch (e.type) {
+    case JEV_SECTOR:
+      return;
+    case JEV_BOOT:
+      snprintf(line, sizeof(line), "boot");
+      break;
+    case JEV_MODE:
+      snprintf(line, sizeof(line), "mode %d -> %d", (int8_t)e.a, (int8_t)e.b);
+      break;
+    case JEV_CHECKLIST: {
+      char bits[9];
+      uint8_t n = min(e.b, (uint8_t)8);
+      for (uint8_t i = 0; i < n; i++) bits[i] = (e.a >> i) & 1 ? '1' : '0';
+      bits[n] = '\0';
+      snprintf(line, sizeof(line), "checklist %s", bits);
+      break;
+    }
+    case JEV_DYNAMIC:
+      snprintf(line, sizeof(line), "dynamic req %d intake %d score %d climb %d",
+               e.a & 1, (e.a >> 1) & 1, e.b, e.c);
+      break;
+    case JEV_LEGACY:
+      snprintf(line, sizeof(line), "legacy accel %d ai %d cube %d", e.a & 1, (e.a >> 1) & 1, (e.a >> 2) & 1);
+      break;
+    case JEV_DROP:
+      snprintf(line, sizeof(line), "drop %s %s", sources[e.a & 1], e.b < 2 ? reasons[e.b] : "?");
+      break;
+    case JEV_OVERRUN:
+      snprintf(line, sizeof(line), "overrun %u ms in mode %d", (unsigned)(e.a | e.b << 8), (int8_t)e.c);
+      break;
+    default:
+      snprintf(line, sizeof(line), "type %u %u %u %u", e.type, e.a, e.b, e.c);
+      break;
+  }
+  Serial.print(e.ms);
+  Serial.print(" ");
+  Serial.println(line);
+}
+
+void journalDump() {
+  if (!ready) {
+    Serial.println("journal: no flash");
+    return;
+  }
+  // sequence numbers rise around the ring, so start at the lowest and walk forward;
+  // a sector waiting to be reused still holds the oldest events and is read first
+  uint32_t seqs[JOURNAL_SECTORS];
+  bool any = false;
+  uint16_t start = 0;
+  for (uint16_t s = 0; s < JOURNAL_SECTORS; s++) {
+    JournalEvent h;
+    storageRead((uint32_t)s * JOURNAL_SECTOR_SIZE, (uint8_t *)&h, sizeof(h));
+    seqs[s] = (h.type == JEV_SECTOR) ? h.ms : 0;
+    if (seqs[s] && (!any || (int32_t)(seqs[s] - seqs[start]) < 0)) {
+      start = s;
+      any = true;
+    }
+  }
+  uint32_t events = 0;
+  for (uint16_t i = 0; any && i < JOURNAL_SECTORS; i++) {
+    uint16_t s = (start + i) % JOURNAL_SECTORS;
+    if (!seqs[s]) continue;
+    uint8_t page[JOURNAL_PAGE_SIZE];
+    bool end = false;
+    for (uint32_t p = 0; p < JOURNAL_SECTOR_SIZE && !end; p += JOURNAL_PAGE_SIZE) {
+      storageRead((uint32_t)s * JOURNAL_SECTOR_SIZE + p, page, sizeof(page));
+      for (uint16_t k = 0; k < JOURNAL_PAGE_SIZE; k += sizeof(JournalEvent)) {
+        JournalEvent e;
+        memcpy(&e, page + k, sizeof(e));
+        if (e.type == JEV_END) {
+          end = true;
+          break;
+        }
+        if (e.type == JEV_SECTOR) continue;
+        printEvent(e);
+        events++;
+      }
+    }
+  }
+  Serial.print(events);
+  Serial.print(" events, ");
+  Serial.print((uint16_t)(head - tail) / sizeof(JournalEvent));
+  Serial.println(" still queued in RAM");
+}
+
+void journalReport() {
+  if (!ready) {
+    Serial.println("journal: no flash");
+    return;
+  }
+  Serial.print("journal: sector ");
+  Serial.print(sector);
+  Serial.print("/");
+  Serial.print(JOURNAL_SECTORS);
+  Serial.print(" seq ");
+  Serial.print(seq);
+  Serial.print(" offset ");
+  Serial.println(offset);
+  Serial.print("  queued ");
+  Serial.print((uint16_t)(head - tail) / sizeof(JournalEvent));
+  Serial.print(" events, lost ");
+  Serial.println(lost);
+  Serial.print("  erases ");
+  Serial.print(erases);
+  Serial.print(", programs ");
+  Serial.print(programs);
+  Serial.print(", ");
+  Serial.print(bytesWritten);
+  Serial.println(" bytes");
+  Serial.print("  busy skips ");
+  Serial.print(busySkips);
+  Serial.print(", worst service ");
+  Serial.print(maxServiceUs);
+  Serial.println(" us");
+}
@@ -0,0 +1,106 @@
+// © 2025 SC5K Systems
+
+#include "src/latency.h"
+#include "src/capture.h"
+#include <Arduino.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+enum TraceState : uint8_t { TRACE_PARSED, TRACE_APPLIED };
+
+struct Trace {
+  uint32_t      seq;
+  unsigned long byteUs, lineUs, parseUs, appliedUs, shownUs;
+  TraceState    state;
+};
+
+// traces waiting for their show(), oldest at 'tail'. only the newest can still be PARSED:
+// dispatch is synchronous, so an older one was either applied or never will be
+static Trace         pending[TRACE_SLOTS];
+static uint8_t       tail = 0, count = 0;
+static bool          open = false;   // the newest entry belongs to the line being dispatched
+static Trace         last;
+static uint32_t      echoed = 0, overrun = 0, skipped = 0;
+
+char *traceBegin(char *line, unsigned long byteUs, unsigned long lineUs) {
+  // a traced line that never reached traceApplied (a command, a malformed line) is dropped
+  // here; untraced lines leave the pending ones alone
+  if (open && pending[(tail + count - 1) % TRACE_SLOTS].state == TRACE_PARSED) count--;
+  open = false;
+  if (*line != '#') return line;
+
+  char *end = nullptr;
+  unsigned long seq = strtoul(line + 1, &end, 10);
+  if (end == line + 1) return line;
+  while (*end == ' ') ++end;
+
+  if (count == TRACE_SLOTS) {
+    tail = (tail + 1) % TRACE_SLOTS;   // more lines than slots before a show(): lose the oldest
+    count--;
+    overrun++;
+  }
+  Trace &t  = pending[(tail + count) % TRACE_SLOTS];
+  t.seq     = seq;
+  t.byteUs  = byteUs;
+  t.lineUs  = lineUs;
+  t.parseUs = micros();
+  t.state   = TRACE_PARSED;
+  count++;
+  open = true;
+  return end;
+}
+
+void traceApplied() {
+  if (!open) return;
+  Trace &t = pending[(tail + count - 1) % TRACE_SLOTS];
+  t.appliedUs = micros();
+  t.state = TRACE_APPLIED;
+  open = false;
+}
+
+void traceShown() {
+  if (!count) return;
+  unsigned long now = micros();
+  while (count && pending[tail].state == TRACE_APPLIED) {
+    last = pending[tail];
+    last.shownUs = now;
+    tail = (tail + 1) % TRACE_SLOTS;
+    count--;
+
+    // show() must not wait on the UART: an echo that doesn't fit in the TX buffer is dropped.
+    // it goes to robotInput(), so a replayed trace's echoes are swallowed with its other answers
+    Stream &rio = robotInput();
+    char echo[80];
+    int len = snprintf(echo, sizeof(echo), "@%lu %lu %lu %lu %lu %lu\r\n", (unsigned long)last.seq,
+                       last.shownUs - last.byteUs, last.lineUs - last.byteUs, last.parseUs - last.lineUs,
+                       last.appliedUs - last.parseUs, last.shownUs - last.appliedUs);
+    if (rio.availableForWrite() < len) {
+      skipped++;
+      continue;
+    }
+    rio.write((const uint8_t *)echo, len);
+    echoed++;
+  }
+}
+
+void reportLatency() {
+  Serial.print("traced lines echoed: ");
+  Serial.print(echoed);
+  Serial.print(", lost to a full trace ring: ");
+  Serial.print(overrun);
+  Serial.print(", not echoed (Serial1 busy): ");
+  Serial.println(skipped);
+  if (!echoed && !skipped) return;
+  Serial.print("last #");
+  Serial.print(last.seq);
+  Serial.print(": total ");
+  Serial.print(last.shownUs - last.byteUs);
+  Serial.print(" us = byte->line ");
+  Serial.print(last.lineUs - last.byteUs);
+  Serial.print(" + line->parse ");
+  Serial.print(last.parseUs - last.lineUs);
+  Serial.print(" + parse->apply ");
+  Serial.print(last.appliedUs - last.parseUs);
+  Serial.print(" + apply->show ");
+  Serial.println(last.shownUs - last.appliedUs);
+}
@@ -0,0 +1,71 @@
+// © 2025 SC5K Systems
+
+#include "src/log.h"
+#include <Arduino.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+static_assert((LOG_RING_SIZE & (LOG_RING_SIZE - 1)) == 0, "LOG_RING_SIZE must be a power of two");
+
+// single producer (loop code) / single consumer (logDrain). indices run free and wrap
+// naturally; head is only advanced after the record bytes are in place, tail only after
+// they've been written out, so neither side ever needs to mask interrupts.
+static char ring[LOG_RING_SIZE];
+static volatile uint16_t head = 0;
+static volatile uint16_t tail = 0;
+static uint32_t dropsPending = 0;  // lost since the last queued record, not yet reported
+
+static void put(uint16_t at, const char *s, uint16_t n) {
+  for (uint16_t i = 0; i < n; i++) ring[(uint16_t)(at + i) & (LOG_RING_SIZE - 1)] = s[i];
+}
+
+void logLine(const char *label, const char *text) {
+  // a gap in the stream is reported in place, just ahead of the next record that fits
+  char note[24];
+  uint16_t nn = 0;
+  if (dropsPending) nn = snprintf(note, sizeof(note), "log: %lu dropped\n", (unsigned long)dropsPending);
+
+  uint16_t ln = label ? strlen(label) : 0;
+  uint16_t tn = strlen(text);
+  uint16_t h = head;
+  uint16_t used = (uint16_t)(h - tail);
+  if ((uint32_t)nn + ln + tn + 1 > (uint32_t)(LOG_RING_SIZE - used)) {
+    dropsPending++;
+    return;
+  }
+  put(h, note, nn);
+  put(h + nn, label, ln);
+  put(h + nn + ln, text, tn);
+  put(h + nn + ln + tn, "\n", 1);
+  head = h + nn + ln + tn + 1;
+  dropsPending = 0;
+}
+
+void logPrintf(const char *fmt, ...) {
+  char line[96];
+  va_list ap;
+  va_start(ap, fmt);
+  vsnprintf(line, sizeof(line), fmt, ap);
+  va_end(ap);
+  logLine(nullptr, line);
+}
+
+void logDrain() {
+  int room = Serial.availableForWrite();
+  if (room <= 0) return;
+  if (room > LOG_DRAIN_MAX) room = LOG_DRAIN_MAX;
+
+  uint16_t t = tail;
+  uint16_t avail = (uint16_t)(head - t);
+  uint16_t n = min((uint16_t)room, avail);
+  while (n) {
+    // contiguous run up to the end of the ring
+    uint16_t off = t & (LOG_RING_SIZE - 1);
+    uint16_t run = min(n, (uint16_t)(LOG_RING_SIZE - off));
+    Serial.write((const uint8_t *)ring + off, run);
+    t += run;
+    n -= run;
+  }
+  tail = t;
+}
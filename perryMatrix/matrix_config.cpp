@@ -14,13 +14,16 @@ uint8_t clockPin   = 14;
 uint8_t latchPin   = 15;
 uint8_t oePin      = 16;
 
-// serial buffer pointer (allocated in .ino)
-char *buf = nullptr;
+// serial line buffer for readAndProcess()
+char buf[BUF_SIZE];
 
-// protomatter matrix instance
-Adafruit_Protomatter matrix(
+// protomatter panel instance
+Adafruit_Protomatter panel(
   WIDTH, 6, 1,
   rgbPins, 4, addrPins,
   clockPin, latchPin, oePin,
   true
 );
+
+// portrait canvas presented through the panel
+PerryDisplay matrix(panel);
@@ -0,0 +1,58 @@
+// © 2025 SC5K Systems
+
+#include "src/mem.h"
+#include "src/arena.h"
+#include <Arduino.h>
+#include <stdio.h>
+
+// newlib never hands sbrk'd memory back, so mallinfo().arena only grows: it is the
+// heap's high-water mark. the gap between the break and the stack is what is left.
+#ifdef ARDUINO
+#include <malloc.h>
+extern "C" char *sbrk(int incr);
+#endif
+
+struct MemSample {
+  uint32_t arena, inUse, gap;
+  bool     taken;
+};
+
+static MemSample marks[MEM_MARKS];
+
+static MemSample sample() {
+  MemSample s = { 0, 0, 0, true };
+#ifdef ARDUINO
+  struct mallinfo mi = mallinfo();
+  char top;
+  s.arena = mi.arena;
+  s.inUse = mi.uordblks;
+  s.gap   = &top - sbrk(0);
+#endif
+  return s;
+}
+
+void memMark(MemMark mark) {
+  if (mark < MEM_MARKS && !marks[mark].taken) marks[mark] = sample();
+}
+
+// printSample: one row of the report
+static void printSample(const char *label, const MemSample &s) {
+  char line[80];
+  snprintf(line, sizeof(line), "  %-6s heap %6lu  in use %6lu  stack gap %6lu",
+           label, (unsigned long)s.arena, (unsigned long)s.inUse, (unsigned long)s.gap);
+  Serial.println(line);
+}
+
+void memReport() {
+#ifdef ARDUINO
+  static const char *const names[MEM_MARKS] = { "start", "panel", "boot" };
+  Serial.println("mem: bytes (heap = high-water of the break)");
+  for (uint8_t i = 0; i < MEM_MARKS; i++) {
+    if (marks[i].taken) printSample(names[i], marks[i]);
+  }
+  printSample("now", sample());
+#else
+  Serial.println("mem: heap is only tracked on the board");
+#endif
+  arenaReport();
+}
@@ -0,0 +1,160 @@
+// © 2025 SC5K Systems
+
+#include "src/message.h"
+#include "src/globals.h"
+#include <Arduino.h>
+#include <stdlib.h>
+#include <string.h>
+
+static_assert(sizeof(DynamicMsg) == 4 && sizeof(DynamicLegacyMsg) == 3,
+              "payload structs must be one byte per field");
+
+static const FieldSpec checklistFields[]  = { {0, 1}, {0, 1}, {0, 1}, {0, 1} };
+static const FieldSpec dynamicFields[]    = { {0, 1}, {0, 1}, {0, 4}, {0, 3} };
+static const FieldSpec legacyFields[]     = { {0, 1}, {0, 1}, {0, 1} };
+
+// first match by mode and field count wins; dynamic picks its format by count.
+// missing checklist items read red; extra fields on either format are ignored
+static const MessageSchema schemas[] = {
+  { MODE_CHECKLIST, 1, 255, PAYLOAD_CHECKLIST,    checklistFields },
+  { MODE_DYNAMIC,   4, 255, PAYLOAD_DYNAMIC,         dynamicFields },
+  { MODE_DYNAMIC,   1, 3, PAYLOAD_DYNAMIC_LEGACY, legacyFields },
+};
+static const uint8_t schemaCount = sizeof(schemas) / sizeof(schemas[0]);
+
+bool parsePayload(const char *payload, int8_t mode, Message &out) {
+  out.format = PAYLOAD_NONE;
+  out.fieldCount = 0;
+  memset(out.payload.raw, 0, sizeof(out.payload.raw));
+  const char *p = payload;
+  while (*p == ' ') ++p;
+  if (!*p) return false;
+
+  // fields: comma separated, atoi-style (a token without digits reads as 0)
+  int16_t v[MSG_MAX_FIELDS] = { 0 };
+  uint8_t n = 0;
+  for (;;) {
+    while (*p == ' ') ++p;
+    bool neg = (*p == '-');
+    if (neg) ++p;
+    int16_t x = 0;
+    while (*p >= '0' && *p <= '9') {
+      if (x < 1000) x = x * 10 + (*p - '0');
+      ++p;
+    }
+    if (n < MSG_MAX_FIELDS) v[n] = neg ? -x : x;
+    if (n < 255) n++;
+    while (*p && *p != ',') ++p;
+    if (!*p) break;
+    ++p;
+  }
+  out.fieldCount = n;
+
+  for (uint8_t s = 0; s < schemaCount; s++) {
+    const MessageSchema &sc = schemas[s];
+    if (sc.mode != mode || n < sc.minFields || n > sc.maxFields) continue;
+    out.format = sc.format;
+    uint8_t specs = min(sc.maxFields, (uint8_t)MSG_MAX_FIELDS);
+    for (uint8_t i = 0; i < n && i < specs; i++) {
+      out.payload.raw[i] = (uint8_t)constrain(v[i], (int16_t)sc.fields[i].min, (int16_t)sc.fields[i].max);
+    }
+    return true;
+  }
+  return false;
+}
+
+bool parseMessage(const char *body, Message &out) {
+  memset(&out, 0, sizeof(out));
+  const char *p = body;
+  while (*p == ' ') ++p;
+  out.body = p;
+  if (*p == '?') {
+    out.command = true;
+    return false;
+  }
+
+  // mode token: optional sign and digits
+  bool neg = (*p == '-');
+  if (neg) ++p;
+  if (*p < '0' || *p > '9') return false;
+  int16_t mode = 0;
+  while (*p >= '0' && *p <= '9') {
+    if (mode < 1000) mode = mode * 10 + (*p - '0');
+    ++p;
+  }
+  out.mode = (int8_t)(neg ? -mode : mode);
+  out.hasMode = true;
+  parsePayload(p, out.mode, out);
+  return true;
+}
+
+bool messageEqual(const Message &a, const Message &b) {
+  return a.format == b.format && a.fieldCount == b.fieldCount &&
+         memcmp(a.payload.raw, b.payload.raw, sizeof(a.payload.raw)) == 0;
+}
+
+// the old path for one dynamic line: strtol for the mode, strcmp/strncpy against the
+// previous payload, copy into tmp[24], then atoi/strchr per field
+static int legacyParse(const char *line, char *lastPayload) {
+  char *end = nullptr;
+  long mode = strtol(line, &end, 10);
+  while (*end == ' ') ++end;
+  if (strcmp(end, lastPayload) == 0) return (int)mode;
+  strncpy(lastPayload, end, 31);
+  lastPayload[31] = '\0';
+  char tmp[24];
+  strncpy(tmp, end, sizeof(tmp) - 1);
+  tmp[sizeof(tmp) - 1] = '\0';
+  int v[4] = { 0 };
+  char *p = tmp;
+  for (uint8_t i = 0; i < 4; i++) {
+    v[i] = atoi(p);
+    char *c = strchr(p, ',');
+    if (!c) break;
+    p = c + 1;
+  }
+  return (int)mode + v[0] + v[1] + v[2] + v[3];
+}
+
+void benchParse() {
+  static const char *const lines[] = {
+    "2 1,0,0,0", "2 1,1,0,0", "2 0,0,3,0", "2 0,0,0,3", "0 1,1,0,1", "0 1,1,1,1", "2 1,0,1", "1",
+  };
+  const uint8_t lineCount = sizeof(lines) / sizeof(lines[0]);
+  const uint16_t reps = 500;
+  const uint32_t total = (uint32_t)lineCount * reps;
+  volatile int sink = 0;
+
+  char lastPayload[32] = "";
+  unsigned long t0 = micros();
+  for (uint16_t r = 0; r < reps; r++) {
+    for (uint8_t i = 0; i < lineCount; i++) sink += legacyParse(lines[i], lastPayload);
+  }
+  unsigned long oldUs = micros() - t0;
+
+  Message msg, last;
+  memset(&last, 0, sizeof(last));
+  uint32_t changes = 0;
+  t0 = micros();
+  for (uint16_t r = 0; r < reps; r++) {
+    for (uint8_t i = 0; i < lineCount; i++) {
+      parseMessage(lines[i], msg);
+      if (!messageEqual(msg, last)) {
+        last = msg;
+        changes++;
+      }
+    }
+  }
+  unsigned long newUs = micros() - t0;
+  sink += changes;
+
+  Serial.print("parse ");
+  Serial.print(total);
+  Serial.println(" lines:");
+  Serial.print("  strtol/strncpy/atoi: ");
+  Serial.print(oldUs ? total * 1000.0f / oldUs : 0.0f, 1);
+  Serial.println(" lines/ms");
+  Serial.print("  schema parser:       ");
+  Serial.print(newUs ? total * 1000.0f / newUs : 0.0f, 1);
+  Serial.println(" lines/ms");
+}
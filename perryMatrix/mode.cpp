@@ -0,0 +1,199 @@
+// © 2025 SC5K Systems
+
+#include "src/mode.h"
+#include "src/matrix_config.h"
+#include "src/boot_sequence.h"
+#include "src/checklist.h"
+#include "src/autonomous.h"
+#include "src/dynamic.h"
+#include "src/shutdown.h"
+#include "src/journal.h"
+#include "src/transition.h"
+#include "src/pacer.h"
+#include <Arduino.h>
+#include <stdio.h>
+
+// ---- per-mode hooks ----
+static void enterChecklist(const Message &msg) {
+  if (msg.format != PAYLOAD_NONE) processChecklistMessage(msg.payload.checklist);
+}
+// leaving checklist stops its idle chain (sponsor -> perry -> audio)
+static void exitChecklist() {
+  audioActive = sponsorLaunched = perryActive = false;
+}
+static void enterAutonomous(const Message &msg) {
+  (void)msg;
+  initAutonomous();
+}
+static void frameAutonomous() {
+  if (autoActive) runAutonomousFrame();
+}
+static void enterDynamic(const Message &msg) {
+  initDynamic();
+  if (msg.format != PAYLOAD_NONE) updateDynamicFromMessage(msg);
+}
+static void updateDynamic(const Message &msg) {
+  if (msg.format != PAYLOAD_NONE) updateDynamicFromMessage(msg);
+}
+static void enterShutdown(const Message &msg) {
+  (void)msg;
+  initShutdown();
+}
+static void enterBlank(const Message &msg) {
+  (void)msg;
+  matrix.fillScreen(0);
+  matrix.show();
+}
+
+uint8_t checklistFps  = 100;   // checklist and its idle chain
+uint8_t autonomousFps = 25;
+uint8_t dynamicFps    = 60;
+uint8_t shutdownFps   = 60;
+
+// registry, indexed by mode + 1; autonomous and shutdown ignore payload updates.
+// MODE_NULL is the time before the first robot message, when the boot animation runs
+static const ModeOps modeTable[] = {
+  { "boot",       nullptr,         nullptr,         bootSequenceStep,  nullptr,       nullptr,            nullptr },
+  { "checklist",  enterChecklist,  enterChecklist,  runBootSequence,   exitChecklist, nullptr,            &checklistFps },
+  { "autonomous", enterAutonomous, nullptr,         frameAutonomous,   nullptr,       nullptr,            &autonomousFps },
+  { "dynamic",    enterDynamic,    updateDynamic,   runDynamicFrame,   nullptr,       dynamicSensorBegin, &dynamicFps },
+  { "shutdown",   enterShutdown,   nullptr,         runShutdownFrame,  nullptr,       nullptr,            &shutdownFps },
+};
+static_assert(sizeof(modeTable) / sizeof(modeTable[0]) == MODE_SLOTS, "one registry entry per mode slot");
+
+// any other mode number blanks the panel and idles
+static const ModeOps unknownMode = { "unknown", enterBlank, nullptr, nullptr, nullptr, nullptr, nullptr };
+
+// the match runs checklist -> autonomous -> dynamic -> shutdown; next match starts at checklist
+static const int8_t nextInMatch[MODE_SLOTS] = {
+  MODE_CHECKLIST, MODE_AUTONOMOUS, MODE_DYNAMIC, MODE_SHUTDOWN, MODE_CHECKLIST
+};
+
+static const ModeOps &opsFor(int8_t mode) {
+  uint8_t slot = modeSlot(mode);
+  return slot < MODE_SLOTS ? modeTable[slot] : unknownMode;
+}
+
+const char *modeName(int8_t mode) {
+  return opsFor(mode).name;
+}
+
+// ---- switch latency ----
+// from the switching line's dispatch to the end of the first loop pass in which the new
+// mode has shown a frame
+struct SwitchStat {
+  uint16_t count;
+  uint32_t lastUs, maxUs;
+};
+
+static SwitchStat switches[MODE_SLOTS][MODE_SLOTS];
+static bool     switchPending = false;
+static int8_t   switchFrom = MODE_NULL;
+static unsigned long switchUs = 0;
+static uint32_t showsAtSwitch = 0;
+
+// the line that switched to, or last updated, the running mode; modeRestore() replays it
+static Message  modeMsg;
+
+static uint32_t framesInMode = 0;
+static bool     prewarmed = false;
+static int8_t   prewarmedMode = MODE_NULL;
+
+void modeDispatch(const Message &msg) {
+  // the first robot message ends the boot animation early
+  bootSequenceSkip(msg.mode);
+  // and every line is drawn in the pass it arrives, not at the next frame slot
+  pacerKick();
+
+  if (msg.mode == currentMode) {
+    const ModeOps &ops = opsFor(currentMode);
+    if (ops.update) ops.update(msg);
+    if (msg.format != PAYLOAD_NONE) modeMsg = msg;
+    return;
+  }
+
+  switchUs = micros();
+  showsAtSwitch = matrix.shows;
+  transitionStart();
+  switchFrom = currentMode;
+  const ModeOps &from = opsFor(currentMode);
+  if (from.exit) from.exit();
+  lastMode    = currentMode;
+  currentMode = Mode(msg.mode);
+  journalEvent(JEV_MODE, (uint8_t)lastMode, (uint8_t)currentMode);
+  const ModeOps &to = opsFor(currentMode);
+  if (to.enter) to.enter(msg);
+  modeMsg = msg;
+  modeRetarget();
+  switchPending = true;
+  framesInMode = 0;
+  prewarmed = false;
+}
+
+void modeFrame() {
+  // between frames a pass only reads serial
+  if (!pacerFrameDue()) return;
+  const ModeOps &ops = opsFor(currentMode);
+  if (ops.frame) ops.frame();
+  pacerFrameEnd();
+
+  if (switchPending && matrix.shows != showsAtSwitch) {
+    switchPending = false;
+    uint8_t a = modeSlot(switchFrom), b = modeSlot(currentMode);
+    if (a < MODE_SLOTS && b < MODE_SLOTS) {
+      SwitchStat &s = switches[a][b];
+      s.lastUs = micros() - switchUs;
+      if (s.lastUs > s.maxUs) s.maxUs = s.lastUs;
+      s.count++;
+    }
+  }
+
+  // once the mode has settled, do the next mode's slow setup while nothing is switching
+  framesInMode++;
+  if (!prewarmed && framesInMode >= MODE_PREWARM_FRAMES) {
+    prewarmed = true;
+    uint8_t slot = modeSlot(currentMode);
+    if (slot < MODE_SLOTS) {
+      const ModeOps &next = opsFor(nextInMatch[slot]);
+      if (next.prewarm) {
+        next.prewarm();
+        prewarmedMode = nextInMatch[slot];
+      }
+    }
+  }
+}
+
+void modeRetarget() {
+  const ModeOps &ops = opsFor(currentMode);
+  pacerTarget(currentMode, ops.fps ? *ops.fps : 0);
+}
+
+void modeRestore() {
+  const ModeOps &ops = opsFor(currentMode);
+  if (currentMode == MODE_NULL || currentMode == MODE_CHECKLIST) {
+    // the idle chain starts over from the static screen
+    exitChecklist();
+    drawChecklistStatic();
+  } else if (ops.enter) {
+    ops.enter(modeMsg);
+  }
+  modeRetarget();
+}
+
+void modeReport() {
+  char line[72];
+  snprintf(line, sizeof(line), "mode: %s, %lu frames%s%s", opsFor(currentMode).name, (unsigned long)framesInMode,
+           prewarmedMode != MODE_NULL ? ", pre-warmed " : "",
+           prewarmedMode != MODE_NULL ? opsFor(prewarmedMode).name : "");
+  Serial.println(line);
+  Serial.println("  from       to          count   last us  worst us");
+  for (uint8_t a = 0; a < MODE_SLOTS; a++) {
+    for (uint8_t b = 0; b < MODE_SLOTS; b++) {
+      const SwitchStat &s = switches[a][b];
+      if (!s.count) continue;
+      snprintf(line, sizeof(line), "  %-10s %-10s %6u %9lu %9lu", modeTable[a].name, modeTable[b].name,
+               s.count, (unsigned long)s.lastUs, (unsigned long)s.maxUs);
+      Serial.println(line);
+    }
+  }
+}
@@ -0,0 +1,149 @@
+// © 2025 SC5K Systems
+
+#include "src/pacer.h"
+#include "src/cpu.h"
+#include "src/clock.h"
+#include "src/capture.h"
+#include "src/mode.h"
+#include <Arduino.h>
+#include <stdio.h>
+
+// frames are due on a fixed schedule per mode. a pass that finds no frame due only reads
+// serial, and the end of loop() sleeps until the next deadline. a robot line or a USB byte
+// wakes the core early, and a dispatched line makes the next frame due at once, so input is
+// never held back to the frame rate.
+
+struct PacerStat {
+  uint8_t  fps;                 // target, 0 when unpaced
+  uint32_t frames, overruns, skipped, degrades, wakes;
+  uint32_t costMax;             // us
+  uint64_t costSum;             // us
+  uint32_t spans;               // frame-start intervals summed in spanUs
+  uint64_t spanUs;
+};
+
+static PacerStat stats[MODE_SLOTS];
+static bool     enabled = PACER_ENABLED;
+static uint8_t  slot = 0;
+static uint32_t periodUs = 0;   // at the target rate; 0 while unpaced
+static uint8_t  divisor = 1;    // frames run every 'divisor' periods once degraded
+static unsigned long nextUs = 0, frameUs = 0, lastFrameUs = 0;
+static uint32_t lastCostUs = 0; // the last frame, paced or not
+static bool     haveLast = false;
+static uint8_t  slowRun = 0, fastRun = 0;
+
+void pacerInit() {
+#ifdef __SAMD51__
+  // WFI stops the core only; SysTick, the panel refresh timer, USB and the UARTs keep running
+  PM->SLEEPCFG.bit.SLEEPMODE = PM_SLEEPCFG_SLEEPMODE_IDLE_Val;
+  while (PM->SLEEPCFG.bit.SLEEPMODE != PM_SLEEPCFG_SLEEPMODE_IDLE_Val) {}
+#endif
+}
+
+void pacerTarget(Mode mode, uint8_t fps) {
+  slot = modeSlot(mode);
+  if (slot >= MODE_SLOTS) slot = 0;
+  stats[slot].fps = fps;
+  periodUs = fps ? 1000000UL / fps : 0;
+  divisor  = 1;
+  slowRun  = fastRun = 0;
+  haveLast = false;
+  nextUs   = clockMicros();
+}
+
+void pacerKick() {
+  nextUs = clockMicros();
+}
+
+bool pacerFrameDue() {
+  unsigned long now = clockMicros();
+  if (enabled && periodUs && (long)(now - nextUs) < 0) return false;
+  frameUs = now;
+  return true;
+}
+
+void pacerFrameEnd() {
+  unsigned long now = clockMicros();
+  uint32_t cost = now - frameUs;
+  lastCostUs = cost;
+  if (!enabled || !periodUs) return;
+  PacerStat &s = stats[slot];
+  uint32_t period = periodUs * divisor;
+  s.frames++;
+  s.costSum += cost;
+  if (cost > s.costMax) s.costMax = cost;
+  if (haveLast) {
+    s.spans++;
+    s.spanUs += frameUs - lastFrameUs;
+  }
+  lastFrameUs = frameUs;
+  haveLast = true;
+
+  // the schedule doesn't slip with a late pass; deadlines already gone are skipped, not
+  // rendered back to back to catch up
+  nextUs += period;
+  if ((long)(now - nextUs) >= 0) {
+    uint32_t missed = (now - nextUs) / period + 1;
+    s.overruns++;
+    s.skipped += missed;
+    nextUs += missed * period;
+  }
+
+  // a frame that can't fit its period drops the mode to a rate it can hold
+  if (cost > period) {
+    fastRun = 0;
+    if (++slowRun >= PACER_DEGRADE_FRAMES && divisor < PACER_MAX_DIVISOR) {
+      divisor++;
+      slowRun = 0;
+      s.degrades++;
+    }
+  } else {
+    slowRun = 0;
+    if (divisor > 1 && cost < periodUs * (divisor - 1) * 3 / 4) {
+      if (++fastRun >= PACER_RECOVER_FRAMES) {
+        divisor--;
+        fastRun = 0;
+      }
+    } else {
+      fastRun = 0;
+    }
+  }
+}
+
+static bool inputWaiting() {
+  return robotInput().available() > 0 || Serial.available() > 0;
+}
+
+void pacerIdle() {
+  if (!enabled || !periodUs) return;
+  cpuSleepUntil(nextUs, inputWaiting);
+  if ((long)(clockMicros() - nextUs) < 0) stats[slot].wakes++;
+}
+
+uint32_t pacerFrameCost() {
+  return lastCostUs;
+}
+
+void pacerEnable(bool on) {
+  enabled = on;
+  nextUs = clockMicros();
+}
+
+void pacerReport() {
+  char line[80];
+  snprintf(line, sizeof(line), "pace: %s, %s at %u fps / %u", enabled ? "on" : "off (every pass)",
+           modeName((int8_t)slot - 1), stats[slot].fps, divisor);
+  Serial.println(line);
+  Serial.println("mode        fps    got  mean us   max us  overrun  skipped  slower  wakes");
+  for (uint8_t m = 0; m < MODE_SLOTS; m++) {
+    const PacerStat &s = stats[m];
+    if (!s.frames) continue;
+    uint32_t got10 = s.spanUs ? (uint32_t)((uint64_t)s.spans * 10000000ULL / s.spanUs) : 0;
+    snprintf(line, sizeof(line), "%-10s %4u %4lu.%lu %8lu %8lu %8lu %8lu %7lu %6lu", modeName((int8_t)m - 1), s.fps,
+             (unsigned long)(got10 / 10), (unsigned long)(got10 % 10),
+             (unsigned long)(s.costSum / s.frames), (unsigned long)s.costMax,
+             (unsigned long)s.overruns, (unsigned long)s.skipped, (unsigned long)s.degrades,
+             (unsigned long)s.wakes);
+    Serial.println(line);
+  }
+}
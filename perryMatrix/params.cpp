@@ -0,0 +1,126 @@
+// © 2025 SC5K Systems
+
+#include "src/params.h"
+#include "src/globals.h"
+#include "src/shutdown.h"
+#include "src/mode.h"
+#include "src/power.h"
+#include "src/settings.h"
+#include "src/boot_sequence.h"
+#include <Arduino.h>
+#include <string.h>
+#include <stdio.h>
+
+static const Param params[] = {
+  { "typeDelay",        PARAM_ULONG,  &typeDelay,        0,     1000,    nullptr,          "ms per typed boot/checklist character" },
+  { "boxDelay",         PARAM_ULONG,  &boxDelay,         0,     2000,    nullptr,          "ms for a checklist box to sweep" },
+  { "textInterval",     PARAM_ULONG,  &textInterval,     50,    5000,    nullptr,          "autonomous AUTO LOCK blink, ms" },
+  { "dynReqInterval",   PARAM_U16,    &dynReqInterval,   20,    5000,    nullptr,          "dynamic FETCH PIECE blink, ms" },
+  { "dynAiInterval",    PARAM_U16,    &dynAiInterval,    20,    5000,    nullptr,          "dynamic AI swap cadence, ms" },
+  { "charDelay",        PARAM_ULONG,  &charDelay,        1,     1000,    nullptr,          "shutdown fake code, ms per character" },
+  { "scrollSpeed",      PARAM_INT,    &scrollSpeed,      1,     8,       nullptr,          "sponsor scroll, px per frame" },
+  { "hueDelta",         PARAM_U8,     &hueDelta,         0,     255,     nullptr,          "sponsor hue step per frame" },
+  { "smoothingFactor",  PARAM_INT,    &smoothingFactor,  1,     64,      nullptr,          "audio input smoothing, 1 = none" },
+  { "audioDuration",    PARAM_ULONG,  &audioDuration,    1000,  120000,  nullptr,          "audio visualizer run, ms" },
+  { "dripFeedMode",     PARAM_BOOL,   &dripFeedMode,     0,     1,       robotInputFlush,  "queue and coalesce serial lines" },
+  { "checklistFps",     PARAM_U8,     &checklistFps,     0,     200,     modeRetarget,     "checklist frame rate, 0 = every pass" },
+  { "autonomousFps",    PARAM_U8,     &autonomousFps,    0,     200,     modeRetarget,     "autonomous frame rate" },
+  { "dynamicFps",       PARAM_U8,     &dynamicFps,       0,     200,     modeRetarget,     "dynamic frame rate" },
+  { "shutdownFps",      PARAM_U8,     &shutdownFps,      0,     200,     modeRetarget,     "shutdown frame rate" },
+  { "pwrLimit",         PARAM_U16,    &powerLimitMa,     0,     20000,   nullptr,          "panel current ceiling, mA, 0 = none" },
+  { "brightness",       PARAM_U8,     &powerBrightness,  0,     255,     nullptr,          "global brightness, 255 = full" },
+};
+#define PARAM_COUNT (sizeof(params) / sizeof(params[0]))
+static_assert(PARAM_COUNT <= SETTINGS_PARAMS, "every parameter must fit the settings record");
+
+static int32_t defaults[PARAM_COUNT];
+
+// paramKey: 16-bit fold of an FNV-1a hash of the name; never 0, which marks a free slot
+static uint16_t paramKey(const char *name) {
+  uint32_t h = 2166136261UL;
+  while (*name) h = (h ^ (uint8_t)*name++) * 16777619UL;
+  uint16_t k = (uint16_t)(h ^ (h >> 16));
+  return k ? k : 1;
+}
+
+int32_t paramGet(const Param &p) {
+  switch (p.type) {
+    case PARAM_BOOL:  return *(bool *)p.value;
+    case PARAM_U8:    return *(uint8_t *)p.value;
+    case PARAM_U16:   return *(uint16_t *)p.value;
+    case PARAM_INT:   return *(int *)p.value;
+    case PARAM_ULONG: return (int32_t)*(unsigned long *)p.value;
+  }
+  return 0;
+}
+
+// store: write without range checks or the change hook
+static void store(const Param &p, int32_t value) {
+  switch (p.type) {
+    case PARAM_BOOL:  *(bool *)p.value = value != 0; break;
+    case PARAM_U8:    *(uint8_t *)p.value = (uint8_t)value; break;
+    case PARAM_U16:   *(uint16_t *)p.value = (uint16_t)value; break;
+    case PARAM_INT:   *(int *)p.value = (int)value; break;
+    case PARAM_ULONG: *(unsigned long *)p.value = (unsigned long)value; break;
+  }
+}
+
+bool paramSet(const Param &p, int32_t value) {
+  if (value < p.min || value > p.max) return false;
+  store(p, value);
+  if (p.changed) p.changed();
+  return true;
+}
+
+void paramReset(const Param &p) {
+  paramSet(p, defaults[&p - params]);
+}
+
+const Param *paramFind(const char *name) {
+  for (uint8_t i = 0; i < PARAM_COUNT; i++) {
+    if (strcmp(params[i].name, name) == 0) return &params[i];
+  }
+  return nullptr;
+}
+
+void paramLoad() {
+  for (uint8_t i = 0; i < PARAM_COUNT; i++) defaults[i] = paramGet(params[i]);
+  // an entry for a parameter that has since been removed, or out of the current range, is skipped
+  for (uint8_t s = 0; s < settings.paramCount; s++) {
+    const SettingsParam &sp = settings.params[s];
+    for (uint8_t i = 0; i < PARAM_COUNT; i++) {
+      if (paramKey(params[i].name) == sp.key) {
+        paramSet(params[i], sp.value);
+        break;
+      }
+    }
+  }
+}
+
+void paramList() {
+  char line[100];
+  for (uint8_t i = 0; i < PARAM_COUNT; i++) {
+    const Param &p = params[i];
+    int32_t v = paramGet(p);
+    char range[16];
+    snprintf(range, sizeof(range), "%ld..%ld", (long)p.min, (long)p.max);
+    snprintf(line, sizeof(line), "%-16s %7ld%c %-12s %s", p.name, (long)v, v != defaults[i] ? '*' : ' ',
+             range, p.help);
+    Serial.println(line);
+  }
+  Serial.println("* = changed from the built-in default");
+}
+
+bool paramSave() {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < PARAM_COUNT; i++) {
+    int32_t v = paramGet(params[i]);
+    if (v == defaults[i]) continue;
+    settings.params[n].key = paramKey(params[i].name);
+    settings.params[n].reserved = 0;
+    settings.params[n].value = v;
+    n++;
+  }
+  settings.paramCount = n;
+  return settingsSave();
+}
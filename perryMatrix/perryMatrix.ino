@@ -8,61 +8,69 @@
 #include "src/autonomous.h"
 #include "src/dynamic.h"
 #include "src/shutdown.h"
+#include "src/text.h"
+#include "src/profiler.h"
+#include "src/cpu.h"
+#include "src/log.h"
+#include "src/journal.h"
+#include "src/clock.h"
+#include "src/settings.h"
+#include "src/mem.h"
+#include "src/mode.h"
+#include "src/pacer.h"
+#include "src/params.h"
 
 void setup() {
+  memMark(MEM_START);
   // init usb and RoboRIO serial
   Serial.begin(115200);
   Serial1.begin(9600);
-  delay(500);
+  settingsLoad();
+  paramLoad();
+  // give the USB host a moment to attach, unless a fast boot wants the panel up first
+  if (!settings.fastBoot) clockDelay(500);
   // set short serial timeouts (~50ms) to avoid partial lines from RoboRIO
   Serial.setTimeout(50);
   Serial1.setTimeout(50);
+  profInit();
   if (Serial) {
     Serial.println("USB serial active");
     Serial.println("RoboRIO serial active");
   }
 
   // Matrix init
-  if (matrix.begin() != PROTOMATTER_OK) while (1) delay(10);
-  matrix.setRotation(1);
+  // the canvas is already portrait, so no rotation remap per pixel
+  if (matrix.begin() != PROTOMATTER_OK) while (1) clockDelay(10);
+  memMark(MEM_PANEL);
+  cpuInit();
+  pacerInit();
+  journalInit();
   matrix.setTextWrap(false);
   matrix.setTextSize(1);
+  initTextAtlas();
 
-  // allocate the shared buffer used by readAndProcess()
-  buf = new char[32];
-
-  // one‐time boot sequence (splash, color test, write-on checklist)
+  // one‐time boot sequence (splash, color test, write-on checklist), stepped from loop()
   initBootSequence();
 }
 
 void loop() {
+  PROFILE_SCOPE("loop");
+  cpuTick(currentMode);
+
   // 1) read/dispatch incoming messages from RoboRIO or USB
   handleRobotMessage();
 
-  // 2) run per‐mode logic
-  switch (currentMode) {
-    case MODE_CHECKLIST:
-    // checklist mode: update checklist and run scroller/perry/audio
-      runBootSequence();
-      break;
+  // 2) run per‐mode logic through the mode table (mode.cpp) when its frame is due;
+  // before the first robot message that is the boot animation
+  modeFrame();
+  bootNoteFrame();
 
-    case MODE_AUTONOMOUS:
-    // autonomous mode: run auto animation while active
-      if (autoActive) runAutonomousFrame();
-      break;
+  // 3) flush queued debug output, only as much as USB will take right now
+  logDrain();
 
-    case MODE_DYNAMIC:
-    // dynamic mode: draw network and optional accel/AI/cube
-      runDynamicFrame();
-      break;
+  // 4) note overruns and move journaled events toward flash without waiting on it
+  journalFrame(currentMode);
 
-    case MODE_SHUTDOWN:
-    // shutdown mode: draw match over header and scroll fake code
-      runShutdownFrame();
-      break;
-
-    default:
-    // MODE_NULL or undefined: do nothing
-      break;
-  }
+  // 5) sleep until the next frame is due, or until a byte arrives
+  pacerIdle();
 }
@@ -3,12 +3,16 @@
 #include "src/perry_loader.h"
 #include "src/globals.h"
 #include "src/matrix_config.h"
+#include "src/text.h"
+#include "src/clock.h"
+#include "src/arena.h"
 #include <string.h>
 #include <Arduino.h>
 
 // initPerryLoader: measure line lengths, reset indices, set timing, center text and clear screen
 void initPerryLoader() {
   // reset lengths and decryption state
+  arenaClaim(ARENA_PERRY);
   for (uint8_t i = 0; i < perryLineCount4; i++) {
     perryLens4[i]     = strlen(perryLines4[i]);
     perryDone[i]      = 0;
@@ -22,7 +26,7 @@ void initPerryLoader() {
   p_linesDone   = 0;
 
   // initialize timing
-  unsigned long now = millis();
+  unsigned long now = clockMillis();
   p_lastUpdate = now;
   p_lastObf    = now;
   p_startObf   = now + IPAU;
@@ -45,7 +49,7 @@ char getRandomCharacterP() {
 
 // writeEncryptedText4: type lines one char at a time as random glyphs
 void writeEncryptedText4() {
-  unsigned long t = millis();
+  unsigned long t = clockMillis();
   if (t - p_lastUpdate < WDEL) return;
 
   int sw = matrix.width();
@@ -55,9 +59,7 @@ void writeEncryptedText4() {
       int x = (sw - perryLens4[i] * CHAR_W) / 2
             + perryWriteIdx4[i] * CHAR_W;
       int y = p_yStart + i * (CHAR_H + p_lineGap);
-      matrix.setCursor(x, y);
-      matrix.setTextColor(matrix.color565(255, 215, 0));
-      matrix.print(getRandomCharacterP());
+      textDrawChar(x, y, getRandomCharacterP(), matrix.color565(255, 215, 0));
       perryWriteIdx4[i]++;
       matrix.show();
       p_lastUpdate = t;
@@ -76,16 +78,14 @@ void displayRandomText4() {
   for (uint8_t i = 0; i < perryLineCount4; i++) {
     int x = (sw - perryLens4[i] * CHAR_W) / 2;
     int y = p_yStart + i * (CHAR_H + p_lineGap);
-    matrix.setCursor(x, y);
 
     for (uint8_t j = 0; j < perryLens4[i]; j++) {
       if (!perryDec[i][j]) {
-        matrix.setTextColor(matrix.color565(255, 215, 0));
-        matrix.print(getRandomCharacterP());
+        textDrawChar(x, y, getRandomCharacterP(), matrix.color565(255, 215, 0));
       } else {
-        matrix.setTextColor(matrix.color565(100, 149, 237));
-        matrix.print(perryLines4[i][j]);
+        textDrawChar(x, y, perryLines4[i][j], matrix.color565(100, 149, 237));
       }
+      x += CHAR_W;
     }
   }
 
@@ -108,5 +108,5 @@ void updateDecryption4() {
     }
   }
   displayRandomText4();
-  p_lastUpdate = millis();
+  p_lastUpdate = clockMillis();
 }
@@ -0,0 +1,109 @@
+// © 2025 SC5K Systems
+
+#include "src/power.h"
+#include <Arduino.h>
+#include <stdio.h>
+
+// protomatter's bit-plane duty is linear in the 565 value, so a pixel's current is the sum of
+// its three channels scaled to a common 0..63 range and the frame's is the sum over pixels
+
+uint16_t powerLimitMa    = POWER_LIMIT_MA;
+uint8_t  powerBrightness = 255;
+
+static uint16_t lastLit = 0, lastMa = 0, lastOutMa = 0, peakMa = 0;
+static uint16_t lastScale = 256;   // q8 applied to the last frame
+static uint32_t frames = 0, limited = 0;
+static uint32_t costLastUs = 0, costMaxUs = 0;
+
+// channel tables for the scale they were built for, shifted into place
+static uint16_t lutScale = 0;
+static uint16_t lutR[32], lutG[64], lutB[32];
+
+// channelSum: r*2 + g + b*2 over the frame, two pixels a word in 16-bit lanes. a pixel adds at
+// most 187 to its lane, so the lanes are folded into the total every 256 words
+static uint32_t channelSum(const uint16_t *frame, uint16_t n, uint16_t &lit) {
+  const uint32_t *w = (const uint32_t *)frame;
+  uint16_t words = n / 2;
+  uint32_t total = 0;
+  lit = 0;
+  for (uint16_t i = 0; i < words;) {
+    uint16_t end = min((uint16_t)(i + 256), words);
+    uint32_t acc = 0;
+    for (; i < end; i++) {
+      uint32_t x = w[i];
+      acc += ((x >> 10) & 0x003E003EUL) + ((x >> 5) & 0x003F003FUL) + ((x << 1) & 0x003E003EUL);
+      lit += ((x & 0xFFFF) != 0) + ((x >> 16) != 0);
+    }
+    total += (acc & 0xFFFF) + (acc >> 16);
+  }
+  return total;
+}
+
+// ledMa: channel sum to mA, 63 per fully lit channel
+static uint16_t ledMa(uint32_t sum) {
+  uint32_t mA = sum * POWER_UA_PER_CHANNEL / 63 / 1000;
+  return mA > 0xFFFF ? 0xFFFF : (uint16_t)mA;
+}
+
+static void buildLut(uint16_t scale) {
+  for (uint16_t v = 0; v < 32; v++) {
+    lutR[v] = ((v * scale) >> 8) << 11;
+    lutB[v] = (v * scale) >> 8;
+  }
+  for (uint16_t v = 0; v < 64; v++) lutG[v] = ((v * scale) >> 8) << 5;
+  lutScale = scale;
+}
+
+void powerFrame(uint16_t *frame, uint16_t n) {
+  if (!frame) return;
+  unsigned long t0 = micros();
+  uint16_t lit;
+  uint16_t mA = ledMa(channelSum(frame, n, lit));
+
+  // the limiter's scale is worked out for this frame, so no frame goes out over budget
+  uint16_t scale = powerBrightness + (powerBrightness >> 7);   // 255 -> 256
+  if (powerLimitMa > POWER_BASE_MA && mA > powerLimitMa - POWER_BASE_MA) {
+    uint16_t fit = (uint16_t)((uint32_t)(powerLimitMa - POWER_BASE_MA) * 256 / mA);
+    if (fit < scale) {
+      scale = fit;
+      limited++;
+    }
+  }
+  if (scale < 256) {
+    if (scale != lutScale) buildLut(scale);
+    for (uint16_t i = 0; i < n; i++) {
+      uint16_t p = frame[i];
+      frame[i] = lutR[p >> 11] | lutG[(p >> 5) & 0x3F] | lutB[p & 0x1F];
+    }
+  }
+
+  lastLit   = lit;
+  lastMa    = mA + POWER_BASE_MA;
+  lastOutMa = (uint16_t)((uint32_t)mA * scale / 256) + POWER_BASE_MA;
+  lastScale = scale;
+  if (lastMa > peakMa) peakMa = lastMa;
+  frames++;
+  costLastUs = micros() - t0;
+  if (costLastUs > costMaxUs) costMaxUs = costLastUs;
+}
+
+void powerReport() {
+  char line[72];
+  if (powerLimitMa) {
+    snprintf(line, sizeof(line), "pwr: limit %u mA, brightness %u/255", powerLimitMa, powerBrightness);
+  } else {
+    snprintf(line, sizeof(line), "pwr: no limit, brightness %u/255", powerBrightness);
+  }
+  Serial.println(line);
+  snprintf(line, sizeof(line), "  last frame: %u px lit, %u mA est, %u mA out (scale %u/256)",
+           lastLit, lastMa, lastOutMa, lastScale);
+  Serial.println(line);
+  snprintf(line, sizeof(line), "  peak %u mA est, %lu of %lu frames limited", peakMa,
+           (unsigned long)limited, (unsigned long)frames);
+  Serial.println(line);
+  snprintf(line, sizeof(line), "  cost %lu us last, %lu us worst per frame", (unsigned long)costLastUs,
+           (unsigned long)costMaxUs);
+  Serial.println(line);
+  peakMa = 0;
+  costMaxUs = 0;
+}
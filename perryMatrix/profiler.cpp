@@ -0,0 +1,215 @@
+// © 2025 SC5K Systems
+
+#include "src/profiler.h"
+#include <Arduino.h>
+#include <string.h>
+#include <stdio.h>
+#ifndef ARDUINO
+#include <chrono>
+#endif
+
+#ifdef ARDUINO
+#define PROF_TICKS_PER_US (SystemCoreClock / 1000000UL)
+#else
+#define PROF_TICKS_PER_US 1000UL
+#endif
+
+#define PROF_NONE 0xFF   // no node (top level)
+#define PROF_SKIP 0xFE   // enter refused (table full or too deep); exit ignores it
+
+struct ProfSite {
+  const char *name;
+  uint8_t     lastOuter, lastNode;   // memo of the last (parent -> node) lookup
+};
+
+struct ProfNode {
+  uint8_t  site, parent, depth;
+  uint32_t calls, minTicks, maxTicks;
+  uint64_t totalTicks;
+  uint16_t hist[PROF_HIST_BINS];
+};
+
+static ProfSite sites[PROF_MAX_SITES];
+static uint8_t  siteCount = 0;
+static ProfNode nodes[PROF_MAX_NODES];
+static uint8_t  nodeCount = 0;
+static uint8_t  current = PROF_NONE;   // innermost open scope
+static uint32_t refused = 0;           // enters dropped because a table was full
+static uint32_t scopeCost = 0;         // measured ticks one enter/exit pair adds
+
+void profInit() {
+#ifdef ARDUINO
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+  // calibrate the per-scope cost on a throwaway site, then drop it again
+  uint8_t site = profRegister("calibration");
+  uint32_t t0 = profNow();
+  for (uint16_t i = 0; i < 256; i++) {
+    ProfileScope s(site);
+  }
+  scopeCost = (profNow() - t0) / 256;
+  if (site == siteCount - 1) siteCount--;
+  if (nodeCount && nodes[nodeCount - 1].site == site) nodeCount--;
+}
+
+uint32_t profNow() {
+#ifdef ARDUINO
+  return DWT->CYCCNT;
+#else
+  return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+uint8_t profRegister(const char *name) {
+  if (siteCount >= PROF_MAX_SITES) return PROF_SKIP;
+  sites[siteCount].name      = name;
+  sites[siteCount].lastOuter = PROF_NONE;
+  sites[siteCount].lastNode  = PROF_NONE;
+  return siteCount++;
+}
+
+static void clearStats(ProfNode &n) {
+  n.calls = 0;
+  n.minTicks = UINT32_MAX;
+  n.maxTicks = 0;
+  n.totalTicks = 0;
+  memset(n.hist, 0, sizeof(n.hist));
+}
+
+// findNode: the node for 'site' under 'parent', created on first use
+static uint8_t findNode(uint8_t site, uint8_t parent) {
+  for (uint8_t i = 0; i < nodeCount; i++) {
+    if (nodes[i].site == site && nodes[i].parent == parent) return i;
+  }
+  uint8_t depth = (parent == PROF_NONE) ? 0 : nodes[parent].depth + 1;
+  if (nodeCount >= PROF_MAX_NODES || depth >= PROF_MAX_DEPTH) return PROF_SKIP;
+  ProfNode &n = nodes[nodeCount];
+  n.site   = site;
+  n.parent = parent;
+  n.depth  = depth;
+  clearStats(n);
+  return nodeCount++;
+}
+
+uint8_t profEnter(uint8_t site) {
+  if (site >= siteCount) return PROF_SKIP;
+  ProfSite &s = sites[site];
+  uint8_t node = s.lastNode;
+  if (node == PROF_NONE || s.lastOuter != current) {
+    node = findNode(site, current);
+    if (node == PROF_SKIP) {
+      refused++;
+      return PROF_SKIP;
+    }
+    s.lastOuter = current;
+    s.lastNode  = node;
+  }
+  uint8_t outer = current;
+  current = node;
+  return outer;
+}
+
+// histBin: octave from the leading bit, quarter-octave from the next two
+static uint8_t histBin(uint32_t ticks) {
+  if (ticks < (1UL << PROF_HIST_MIN_LOG2)) return 0;
+  uint8_t lg = 31 - __builtin_clz(ticks);
+  uint8_t oct = lg - PROF_HIST_MIN_LOG2;
+  if (oct >= PROF_HIST_OCTAVES) return PROF_HIST_BINS - 1;
+  return oct * 4 + ((ticks >> (lg - 2)) & 3);
+}
+
+// histUpper: exclusive upper tick bound of a bin
+static uint32_t histUpper(uint8_t bin) {
+  uint8_t oct = bin / 4, sub = bin & 3;
+  return (uint32_t)(5 + sub) << (oct + PROF_HIST_MIN_LOG2 - 2);
+}
+
+void profExit(uint8_t outer, uint32_t ticks) {
+  if (outer == PROF_SKIP) return;
+  ProfNode &n = nodes[current];
+  n.calls++;
+  n.totalTicks += ticks;
+  if (ticks < n.minTicks) n.minTicks = ticks;
+  if (ticks > n.maxTicks) n.maxTicks = ticks;
+  uint16_t &bin = n.hist[histBin(ticks)];
+  if (bin == UINT16_MAX) {
+    // keep the shape, halve the weight, so long runs never saturate
+    for (uint8_t i = 0; i < PROF_HIST_BINS; i++) n.hist[i] >>= 1;
+  }
+  bin++;
+  current = outer;
+}
+
+void profReset() {
+  for (uint8_t i = 0; i < nodeCount; i++) clearStats(nodes[i]);
+  refused = 0;
+}
+
+static uint32_t p99Ticks(const ProfNode &n) {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < PROF_HIST_BINS; i++) total += n.hist[i];
+  uint32_t target = total - total / 100;
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < PROF_HIST_BINS; i++) {
+    seen += n.hist[i];
+    if (seen >= target && seen) return min(histUpper(i), n.maxTicks);
+  }
+  return n.maxTicks;
+}
+
+// printUs: right-aligned microseconds with one decimal (no float printf on target)
+static void printUs(uint32_t ticks) {
+  uint32_t tenths = (uint32_t)((uint64_t)ticks * 10 / PROF_TICKS_PER_US);
+  char cell[16];
+  snprintf(cell, sizeof(cell), "%7lu.%lu", (unsigned long)(tenths / 10), (unsigned long)(tenths % 10));
+  Serial.print(cell);
+}
+
+static void printNode(uint8_t i) {
+  const ProfNode &n = nodes[i];
+  char name[24];
+  snprintf(name, sizeof(name), "%*s%s", n.depth * 2, "", sites[n.site].name);
+  char head[40];
+  snprintf(head, sizeof(head), "%-22s%9lu", name, (unsigned long)n.calls);
+  Serial.print(head);
+  if (n.calls) {
+    printUs(n.minTicks);
+    printUs((uint32_t)(n.totalTicks / n.calls));
+    printUs(p99Ticks(n));
+    printUs(n.maxTicks);
+  }
+  Serial.println();
+  // children in creation order
+  for (uint8_t c = 0; c < nodeCount; c++) {
+    if (nodes[c].parent == i) printNode(c);
+  }
+}
+
+void profReport() {
+  char head[80];
+  snprintf(head, sizeof(head), "%-22s%9s%9s%9s%9s%9s  (us)", "scope", "calls", "min", "mean", "p99", "max");
+  Serial.println(head);
+  uint64_t rootTicks = 0, scopes = 0;
+  for (uint8_t i = 0; i < nodeCount; i++) {
+    scopes += nodes[i].calls;
+    if (nodes[i].parent == PROF_NONE) {
+      rootTicks += nodes[i].totalTicks;
+      printNode(i);
+    }
+  }
+  Serial.print("overhead: ");
+  Serial.print(scopeCost);
+  Serial.print(" ticks/scope, ");
+  Serial.print(rootTicks ? 100.0f * scopes * scopeCost / rootTicks : 0.0f, 3);
+  Serial.print("% of profiled time");
+  if (refused) {
+    Serial.print(", ");
+    Serial.print(refused);
+    Serial.print(" scopes dropped (table full)");
+  }
+  Serial.println();
+}
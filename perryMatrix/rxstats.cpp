@@ -0,0 +1,50 @@
+// © 2025 SC5K Systems
+
+#include "src/rxstats.h"
+#include "src/clock.h"
+#include <Arduino.h>
+#include <string.h>
+#include <stdio.h>
+
+RxStats  rxStats[RX_SOURCES];
+uint32_t rxMalformed = 0;
+static unsigned long sinceMs = 0;
+
+bool rxOverflowByte(uint8_t src, bool &overflow) {
+  rxStats[src].lostBytes++;
+  if (overflow) return false;
+  overflow = true;
+  rxStats[src].truncated++;
+  return true;
+}
+
+void rxLineEnd(uint8_t src, bool &overflow) {
+  rxStats[src].lines++;
+  overflow = false;
+}
+
+void rxReport(Print &out) {
+  static const char *const names[RX_SOURCES] = { "usb", "serial1" };
+  unsigned long ms = clockMillis() - sinceMs;
+  char row[80];
+  out.println("src        bytes  bytes/s    lines  trunc  lost B  merged");
+  for (uint8_t s = 0; s < RX_SOURCES; s++) {
+    const RxStats &r = rxStats[s];
+    snprintf(row, sizeof(row), "%-8s%8lu %8lu %8lu %6lu %7lu %7lu", names[s],
+             (unsigned long)r.bytes, ms ? (unsigned long)((uint64_t)r.bytes * 1000 / ms) : 0UL,
+             (unsigned long)r.lines, (unsigned long)r.truncated,
+             (unsigned long)r.lostBytes, (unsigned long)r.coalesced);
+    out.println(row);
+  }
+  out.print("malformed ");
+  out.print(rxMalformed);
+  out.print(", over ");
+  out.print(ms / 1000);
+  out.println(" s");
+}
+
+void rxReset() {
+  memset(rxStats, 0, sizeof(rxStats));
+  rxMalformed = 0;
+  sinceMs = clockMillis();
+}
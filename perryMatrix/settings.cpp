@@ -0,0 +1,40 @@
+// © 2025 SC5K Systems
+
+#include "src/settings.h"
+#include "src/storage.h"
+#include "src/log.h"
+#include "src/clock.h"
+#include <string.h>
+
+static_assert(sizeof(Settings) <= JOURNAL_PAGE_SIZE, "settings must fit one page");
+
+Settings settings;
+
+static void settingsDefaults() {
+  memset(&settings, 0, sizeof(settings));
+  settings.magic   = SETTINGS_MAGIC;
+  settings.version = SETTINGS_VERSION;
+}
+
+void settingsLoad() {
+  settingsDefaults();
+  if (!storageBegin()) return;
+  Settings stored;
+  storageRead((uint32_t)SETTINGS_SECTOR * JOURNAL_SECTOR_SIZE, (uint8_t *)&stored, sizeof(stored));
+  if (stored.magic != SETTINGS_MAGIC) return;
+  // version 1 had only the boot flag, at the same offset
+  if (stored.version == 1) settings.fastBoot = stored.fastBoot;
+  if (stored.version != SETTINGS_VERSION) return;
+  settings = stored;
+  if (settings.paramCount > SETTINGS_PARAMS) settings.paramCount = 0;
+}
+
+bool settingsSave() {
+  if (!storageBegin()) return false;
+  while (storageBusy()) clockDelay(1);
+  storageErase(SETTINGS_SECTOR);
+  while (storageBusy()) clockDelay(1);
+  storageProgram((uint32_t)SETTINGS_SECTOR * JOURNAL_SECTOR_SIZE, (const uint8_t *)&settings, sizeof(settings));
+  LOG_INFO("settings: saved");
+  return true;
+}
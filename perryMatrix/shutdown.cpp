@@ -3,7 +3,10 @@
 #include "src/shutdown.h"
 #include "src/matrix_config.h"
 #include "src/globals.h"
-#include <Fonts/TomThumb.h>
+#include "src/text.h"
+#include "src/profiler.h"
+#include "src/clock.h"
+#include "src/arena.h"
 
 #include <Arduino.h>
 #include <string.h>
@@ -60,7 +63,7 @@ static const uint8_t fakeCodeCount = sizeof(fakeCode) / sizeof(fakeCode[0]);
 static bool shutdownInitDone = false;
 static unsigned long lastCharMillis = 0;
 // delay between chars in ms for the typing effect
-static const unsigned long charDelay = 30UL; // ms per char
+unsigned long charDelay = 30UL; // ms per char
 static unsigned long hdrAnimStart = 0;
 static uint8_t       hdrAnimPhase = 0; // 0=slide in,1=hold,2=slide out,3=wait
 static const unsigned long hdrSlideDuration = 400UL;
@@ -71,9 +74,9 @@ static uint8_t linesSinceBlank = 0;
 static uint8_t maxLinesBeforeBlank = 2;
 static uint8_t currentStringIdx = 0;
 static uint8_t currentCharIdx   = 0;
-static const uint8_t MAX_ROWS = 24;
-static const uint8_t MAX_COLS = 16;
-static char buffer[MAX_ROWS][MAX_COLS + 1];
+static const uint8_t MAX_ROWS = SHUTDOWN_ROWS;
+static const uint8_t MAX_COLS = SHUTDOWN_COLS;
+static char (*const buffer)[MAX_COLS + 1] = arena.shutdown.buffer;   // in the mode arena
 static uint8_t bufferRows = 0;
 static uint8_t bufferCols = 0;
 static uint8_t curRow  = 0;
@@ -84,8 +87,9 @@ static void shiftBufferUp();
 
 void initShutdown() {
   // Reset state only once per transition into shutdown mode
+  arenaClaim(ARENA_SHUTDOWN);
   shutdownInitDone = true;
-  lastCharMillis = millis();
+  lastCharMillis = clockMillis();
   currentStringIdx = 0;
   currentCharIdx   = 0;
   int16_t yMatch = 1;
@@ -142,7 +146,7 @@ void initShutdown() {
   curRow = 0;
   curCol = 0;
   // Reset animation phases and counters
-  hdrAnimStart = millis();
+  hdrAnimStart = clockMillis();
   hdrAnimPhase = 0;
   linesSinceBlank = 0;
   // Choose an initial number of lines before inserting the next blank.
@@ -164,12 +168,13 @@ static void shiftBufferUp() {
 }
 
 void runShutdownFrame() {
-  // Ensure init has been called
-  if (!shutdownInitDone) {
+  PROFILE_SCOPE("runShutdownFrame");
+  // Ensure init has been called and another mode hasn't since taken the arena
+  if (!shutdownInitDone || arenaOwner() != ARENA_SHUTDOWN) {
     initShutdown();
   }
   // Simulate typing characters into the buffer at charDelay ms intervals
-  unsigned long now = millis();
+  unsigned long now = clockMillis();
   while (now - lastCharMillis >= charDelay) {
     lastCharMillis += charDelay;
     // Fetch current string and character
@@ -239,7 +244,7 @@ void runShutdownFrame() {
   // Ending (off-screen) positions when sliding out
   int16_t matchEndOutX  = matrix.width();
   int16_t overEndOutX   = -overWidth;
-  unsigned long nowMs   = millis();
+  unsigned long nowMs   = clockMillis();
   unsigned long hdrDt   = nowMs - hdrAnimStart;
   float p;
   int16_t matchX;
@@ -283,32 +288,24 @@ void runShutdownFrame() {
   }
   // Draw header text on separate rows.  Red text with default
   // font sizes.  Dashed line drawn below.
-  matrix.setFont();
   uint16_t redCol   = matrix.color565(255,0,0);
   uint16_t white    = matrix.color565(255,255,255);
-  matrix.setTextColor(redCol);
   int16_t yMatchHdr = 1;
   int16_t yOverHdr  = yMatchHdr + CHAR_H;
-  matrix.setCursor(matchX, yMatchHdr);
-  matrix.print(hdr1);
-  matrix.setCursor(overX,  yOverHdr);
-  matrix.print(hdr2);
+  textDrawLabel(matchX, yMatchHdr, hdr1, redCol);
+  textDrawLabel(overX,  yOverHdr,  hdr2, redCol);
   // Dashed line below header, always centred and white
   int16_t yDash = yMatchHdr + CHAR_H * 2 + 1;
   for (int x = 0; x < matrix.width(); x += 3) {
     matrix.drawPixel(x, yDash, white);
   }
-  // Prepare to draw code: set TomThumb font and green text colour
-  matrix.setFont(&TomThumb);
-  matrix.setTextColor(matrix.color565(0,255,0));
+  // Draw code rows in TomThumb (baseline-anchored) and green
+  uint16_t codeCol = matrix.color565(0,255,0);
   // Each row uses a height of 5 pixels plus a 1‑pixel gap.
   const int16_t ttRowH = 5 + 1;
   for (uint8_t r = 0; r < bufferRows; r++) {
     int16_t y = shutdownCodeStartY + (int16_t)r * ttRowH;
-    matrix.setCursor(0, y);
-    matrix.print(buffer[r]);
+    textDraw(0, y, buffer[r], codeCol, 1, FONT_TOMTHUMB);
   }
-  // Restore default font for any subsequent drawing outside shutdown
-  matrix.setFont();
   matrix.show();
 }
\ No newline at end of file
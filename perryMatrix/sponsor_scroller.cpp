@@ -4,6 +4,7 @@
 #include "src/globals.h"
 #include "src/matrix_config.h"
 #include "src/helpers.h"
+#include "src/text.h"
 #include <Arduino.h>
 #include <string.h>
 
@@ -13,11 +14,8 @@ void drawStaticHeader() {
   const char *L1 = "SPON-", *L2 = "-SORS";
   int16_t x1 = (matrix.width() - strlen(L1) * CHAR_W) / 2;
   int16_t x2 = (matrix.width() - strlen(L2) * CHAR_W) / 2;
-  matrix.setTextColor(white);
-  matrix.setCursor(x1, 0);
-  matrix.print(L1);
-  matrix.setCursor(x2, CHAR_H);
-  matrix.print(L2);
+  textDrawLabel(x1, 0, L1, white);
+  textDrawLabel(x2, CHAR_H, L2, white);
   for (int16_t x = 0; x < matrix.width(); x += 4) {
     matrix.drawFastHLine(x, SEP_Y, 2, white);
   }
@@ -52,23 +50,18 @@ void runSponsorScroller() {
   uint8_t len = strlen(txt);
   uint16_t col = wheel(hueOffset);
   for (uint8_t i = 0; i < len; i++) {
-    matrix.drawChar(
-      sponsorX,
-      yOffset + i*CHAR_H,
-      txt[i], col, 0, 1
-    );
+    textDrawChar(sponsorX, yOffset + i*CHAR_H, txt[i], col);
   }
   matrix.fillRect(0, 0, matrix.width(), SEP_Y+1, 0);
   drawStaticHeader();
   matrix.show();
 
-  yOffset   -= SCROLL_SPEED;
-  hueOffset += HUE_DELTA;
+  yOffset   -= scrollSpeed;
+  hueOffset += hueDelta;
   if (yOffset + len*CHAR_H < 0) {
     currentSponsor = (currentSponsor + 1) % sponsorCount;
     sponsorX       = random(0, matrix.width() - CHAR_W + 1);
     hueOffset      = random(0, 256);
     yOffset        = matrix.height();
   }
-  delay(FRAME_DELAY);
 }
@@ -0,0 +1,109 @@
+// © 2025 SC5K Systems
+
+#include "src/sprite.h"
+#include "src/sprite_assets.h"
+#include "src/matrix_config.h"
+#include "src/globals.h"
+#include <Arduino.h>
+
+// blitSprite: clip rows analytically, then walk each row's runs and emit only the visible spans
+void blitSprite(const RleSprite &s, int16_t x, int16_t y, const uint16_t *palette) {
+  const int16_t sw = matrix.width(), sh = matrix.height();
+  if (x >= sw || y >= sh || x + s.w <= 0 || y + s.h <= 0) return;
+
+  const uint16_t *pal = palette ? palette : s.palette;
+  const bool indexed = (s.format == SPRITE_INDEXED);
+  int16_t r0 = (y < 0) ? -y : 0;
+  int16_t r1 = (y + s.h > sh) ? sh - y : s.h;
+
+  for (int16_t r = r0; r < r1; r++) {
+    const uint8_t *p = s.data + s.rows[r];
+    int16_t cx = x;
+    int16_t end = x + s.w;
+    if (end > sw) end = sw;
+    while (cx < end) {
+      uint8_t hdr = *p++;
+      int16_t len = (hdr & 0x7F) + 1;
+      if (!(hdr & 0x80)) {
+        cx += len;
+        continue;
+      }
+      uint16_t col;
+      if (indexed) {
+        col = pal[*p++];
+      } else {
+        col = (uint16_t)p[0] | ((uint16_t)p[1] << 8);
+        p += 2;
+      }
+      int16_t a = cx, b = cx + len;
+      cx = b;
+      if (b <= 0) continue;
+      if (a < 0) a = 0;
+      if (b > end) b = end;
+      matrix.drawFastHLine(a, y + r, b - a, col);
+    }
+  }
+}
+
+// legacyTube: the hand-drawn intake tube the sprite replaced (kept for the benchmark only)
+static void legacyTube(int16_t tx, int16_t ty, int16_t tw, int16_t th) {
+  uint16_t white = matrix.color565(255, 255, 255);
+  matrix.fillRect(tx, ty, tw, th, white);
+  int rimH = 4;
+  int ry = ty + th - rimH;
+  matrix.drawRect(tx, ry, tw, rimH, white);
+  matrix.fillRect(tx + 1, ry + 1, tw - 2, rimH - 2, 0);
+}
+
+// benchSpriteBlit: replay the full tube slide (start above the screen, stop at the network) both ways
+void benchSpriteBlit() {
+  const RleSprite &t = spritePieceTube;
+  const int16_t tx = (matrix.width() - t.w) / 2;
+  const int16_t yStart = -t.h - 4;
+  const int16_t yEnd = SEG_TOP_H - t.h;
+  const uint8_t passes = 20;
+  uint32_t frames = 0, visiblePx = 0;
+
+  // the slide draws over the live frame; the climb celebration only repaints what moved
+  matrix.saveCanvas();
+  unsigned long t0 = micros();
+  for (uint8_t n = 0; n < passes; n++) {
+    for (int16_t ty = yStart; ty <= yEnd; ty++) {
+      blitSprite(t, tx, ty);
+      frames++;
+    }
+  }
+  unsigned long rleUs = micros() - t0;
+
+  t0 = micros();
+  for (uint8_t n = 0; n < passes; n++) {
+    for (int16_t ty = yStart; ty <= yEnd; ty++) {
+      legacyTube(tx, ty, t.w, t.h);
+    }
+  }
+  unsigned long rectUs = micros() - t0;
+
+  for (int16_t ty = yStart; ty <= yEnd; ty++) {
+    int16_t top = max((int16_t)0, ty), bot = min(matrix.height(), (int16_t)(ty + t.h));
+    int16_t l = max((int16_t)0, tx), r = min(matrix.width(), (int16_t)(tx + t.w));
+    if (bot > top && r > l) visiblePx += (uint32_t)(bot - top) * (r - l);
+  }
+  visiblePx *= passes;
+  matrix.restoreCanvas();
+
+  Serial.print("blit: ");
+  Serial.print(frames);
+  Serial.print(" tube frames, ");
+  Serial.print(visiblePx);
+  Serial.println(" visible px");
+  Serial.print("  rle sprite: ");
+  Serial.print((float)rleUs / frames, 2);
+  Serial.print(" us/frame, ");
+  Serial.print(rleUs ? (float)visiblePx / rleUs : 0.0f, 2);
+  Serial.println(" px/us");
+  Serial.print("  legacy rect: ");
+  Serial.print((float)rectUs / frames, 2);
+  Serial.print(" us/frame, ");
+  Serial.print(rectUs ? (float)visiblePx / rectUs : 0.0f, 2);
+  Serial.println(" px/us");
+}
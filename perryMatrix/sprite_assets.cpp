@@ -0,0 +1,49 @@
+// © 2025 SC5K Systems
+// generated by tools/sprite_conv.py -- do not edit by hand
+
+#include "src/sprite_assets.h"
+
+static const uint16_t spriteCheckBoxPalette[] = {
+  0xFFFF,
+};
+static const uint16_t spriteCheckBoxRows[] = {
+  0, 2, 4, 6, 8, 10, 12, 14,
+};
+static const uint8_t spriteCheckBoxData[] = {
+  0x9D, 0x00, 0x9D, 0x00, 0x9D, 0x00, 0x9D, 0x00, 0x9D, 0x00, 0x9D, 0x00,
+  0x9D, 0x00, 0x9D, 0x00,
+};
+const RleSprite spriteCheckBox = {
+  30, 8, SPRITE_INDEXED, 1,
+  spriteCheckBoxPalette, spriteCheckBoxRows, spriteCheckBoxData
+};
+
+static const uint16_t spritePieceTubePalette[] = {
+  0x0000, 0xFFFF,
+};
+static const uint16_t spritePieceTubeRows[] = {
+  0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22,
+  24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46,
+  48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70,
+  72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94,
+  96, 98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118,
+  120, 122, 128, 134,
+};
+static const uint8_t spritePieceTubeData[] = {
+  0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01,
+  0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01,
+  0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01,
+  0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01,
+  0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01,
+  0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01,
+  0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01,
+  0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01,
+  0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01,
+  0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01, 0xA1, 0x01,
+  0xA1, 0x01, 0x80, 0x01, 0x9F, 0x00, 0x80, 0x01, 0x80, 0x01, 0x9F, 0x00,
+  0x80, 0x01, 0xA1, 0x01,
+};
+const RleSprite spritePieceTube = {
+  34, 64, SPRITE_INDEXED, 2,
+  spritePieceTubePalette, spritePieceTubeRows, spritePieceTubeData
+};
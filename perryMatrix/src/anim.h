@@ -0,0 +1,56 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// animation container flags (see tools/anim_encode.py for the byte layout)
+#define ANIM_FLAG_LOOP      0x01
+#define ANIM_MAX_COLOURS    256
+#define ANIM_WINDOW_BYTES   32
+
+// AnimSource: random-access byte reader so containers can live in internal flash or external storage
+struct AnimSource {
+  size_t (*read)(void *ctx, uint32_t offset, uint8_t *dst, size_t n);
+  void    *ctx;
+  uint32_t size;
+};
+
+// AnimPlayer: playback state; frames are decoded run-by-run straight into the matrix canvas,
+// only a small read window and the palette are held in RAM
+struct AnimPlayer {
+  AnimSource    src;
+  int16_t       x, y;
+  uint8_t       w, h;
+  uint8_t       flags;
+  uint16_t      frameCount;
+  uint16_t      paletteSize;
+  uint16_t      palette[ANIM_MAX_COLOURS];
+  uint32_t      firstFrame;       // offset of frame 0 header
+  uint32_t      pos;              // offset of the next frame header
+  uint16_t      frame;            // index of the next frame
+  unsigned long due;              // millis() when the next frame is due
+  bool          playing;
+  uint32_t      shown, dropped;   // frames that reached the panel / were decoded but never shown
+  unsigned long maxLate;          // worst lateness of a shown frame (ms)
+  uint8_t       win[ANIM_WINDOW_BYTES];
+  uint32_t      winBase;
+  uint8_t       winLen, winIdx;
+};
+
+// animFlashSource: wrap a container compiled into flash (e.g. from anim_assets.h)
+AnimSource animFlashSource(const uint8_t *data, uint32_t size);
+
+// animStart: validate the header, load the palette and schedule frame 0 now; false if the container is bad
+bool animStart(AnimPlayer &a, const AnimSource &src, int16_t x, int16_t y);
+
+// animStop: stop playback; the last decoded frame stays on the canvas
+void animStop(AnimPlayer &a);
+
+// animUpdate: decode every frame that is due; returns true if the canvas changed and should be shown.
+// when more than one frame is due, the earlier ones are applied but counted as dropped; at most one loop
+// is decoded per call
+bool animUpdate(AnimPlayer &a);
+
+// animReport: print playback stats for a player over USB serial
+void animReport(const AnimPlayer &a, const char *label);
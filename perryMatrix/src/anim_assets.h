@@ -0,0 +1,9 @@
+// © 2025 SC5K Systems
+// generated by tools/anim_encode.py -- do not edit by hand
+
+#pragma once
+#include <stdint.h>
+
+// climb_burst.gif: 32x48, 24 frames (2 key, 22 delta), 15 colours, 3488 bytes
+extern const uint8_t animClimbBurst[];
+extern const uint32_t animClimbBurstSize;
@@ -0,0 +1,69 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+#include "globals.h"
+#include "matrix_config.h"
+
+// per-mode working sets. only one mode runs at a time (the perry loader and audio vis
+// take turns inside checklist mode), so they overlay each other in one static arena;
+// each set is claimed, zeroed, by its mode's init and is garbage once another claims it
+enum ArenaOwner : uint8_t {
+  ARENA_FREE,
+  ARENA_PERRY,
+  ARENA_AUDIO,
+  ARENA_AUTONOMOUS,
+  ARENA_DYNAMIC,
+  ARENA_SHUTDOWN,
+  ARENA_OWNERS
+};
+
+#define SHUTDOWN_ROWS 24
+#define SHUTDOWN_COLS 16
+
+struct PerryState {
+  uint8_t lens[4];
+  bool    dec[4][16];
+  uint8_t done[4], writeIdx[4];
+};
+
+// the sample window holds FFT_SAMPLES; each frame shifts in the newest half
+struct AudioState {
+  float vReal[FFT_SAMPLES], vImag[FFT_SAMPLES];
+  float smoothedInput[FFT_SAMPLES];
+};
+
+// layer: the static rings on black, rendered once at init and laid over each frame's rings
+struct AutonomousState {
+  Star     stars[MAX_STARS];
+  uint16_t layer[WIDTH * HEIGHT];
+};
+
+struct DynamicState {
+  Node  nodes[NODE_COUNT];
+  float posX[NODE_COUNT], posY[NODE_COUNT];
+  float velX[NODE_COUNT], velY[NODE_COUNT];
+};
+
+struct ShutdownState {
+  char buffer[SHUTDOWN_ROWS][SHUTDOWN_COLS + 1];
+};
+
+union ModeArena {
+  PerryState      perry;
+  AudioState      audio;
+  AutonomousState autonomous;
+  DynamicState    dynamic;
+  ShutdownState   shutdown;
+};
+
+extern ModeArena arena;
+
+// arenaClaim: hand the arena to 'owner' and zero its working set
+void arenaClaim(ArenaOwner owner);
+
+// arenaOwner: the mode whose working set the arena currently holds
+ArenaOwner arenaOwner();
+
+// arenaReport: per-mode footprint (fixed at build time), arena size, current owner and claims
+void arenaReport();
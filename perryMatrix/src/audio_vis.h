@@ -8,6 +8,9 @@
 // readFFT: sample mic, perform FFT and map bins into bar heights and flags
 void readFFT();
 
+// fftBars: the FFT and bar heights over the current window; readFFT() minus the sampling
+void fftBars();
+
 // updatePeaks: update and decay peak levels per bar
 void updatePeaks();
 
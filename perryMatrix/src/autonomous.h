@@ -12,3 +12,6 @@ void initAutonomous();
 
 // runAutonomousFrame: render one frame; toggle text, update circles/stars and draw auto lock box
 void runAutonomousFrame();
+
+// benchAutonomousClip: pixels visited and time per autonomous frame, GFX vs clipped primitives
+void benchAutonomousClip();
@@ -0,0 +1,28 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+// benchIdle: true before a match (boot over, no mode or a checklist not yet ready); otherwise
+// prints "<name>: only before a match..." and returns false
+bool benchIdle(const char *name);
+
+// frames rendered per state when ?bench is given no count
+#define BENCH_FRAMES 60
+
+// benchModes: render 'frames' frames of every mode and sub-state into the canvas with the panel
+// held (checklist, sponsor, perry, audio on a synthetic tone, autonomous, each dynamic state,
+// shutdown), then time show() on its own; prints us/frame and fps per state. the running mode
+// starts over afterwards. refused during a match (benchIdle), and nothing is
+// journaled while it runs
+void benchModes(uint16_t frames);
+
+// ?mb: calls per timed batch when no count is given, and batches per kernel
+#define BENCH_KERNEL_CALLS    200
+#define BENCH_KERNEL_BATCHES  16
+
+// benchKernels: time the small helpers and geometry kernels that sit in hot loops in batches
+// of 'calls', less the cost of an empty call; prints mean ns/call with a 95% interval over
+// the batches, and the fastest batch, which is the one the panel refresh interrupt hit least.
+// same restrictions as benchModes()
+void benchKernels(uint16_t calls);
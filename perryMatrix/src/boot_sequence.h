@@ -6,8 +6,28 @@
 // handleRobotMessage: read serial, parse mode/payload and dispatch
 void handleRobotMessage();
 
-// initBootSequence: run startup animations (splash, options, outline, LED blink, colour test) then draw initial checklist
+// robotInputFlush: drop the lines the drip feed has queued; params.cpp runs it when dripFeedMode changes
+void robotInputFlush();
+
+// initBootSequence: start the startup animations (splash, options, outline, LED blink, colour test,
+// checklist write-on); with the fast boot flag set, draw the checklist at once instead
 void initBootSequence();
 
+// bootSequenceStep: run the next animation step once its delay is up; returns at once when
+// nothing is due or the boot is over, so call it every loop pass
+void bootSequenceStep();
+
+// bootSequenceSkip: end the animation for a robot message in the given mode; no-op once over
+void bootSequenceSkip(int8_t mode);
+
+// bootRunning: the boot animation is still going (no robot message yet and not finished)
+bool bootRunning();
+
+// bootNoteFrame: call after each loop pass's drawing; stamps reset-to-first-frame time once
+void bootNoteFrame();
+
+// bootReport: fast boot flag, how this boot ended and reset-to-first-frame timing
+void bootReport();
+
 // runBootSequence: in checklist mode, run sponsor scroller, perry loader and audio vis based on state
 void runBootSequence();
@@ -0,0 +1,41 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+#include <Stream.h>
+
+// RAM for one recorded trace: 5 bytes per line plus its text
+#define CAPTURE_BYTES   8192
+// a replay keeps running this long after its last line, so trailing animations play out
+#define REPLAY_TAIL_MS  2000
+
+// A trace is the Serial1 traffic of a match as text, one "<ms> <line>" per line, ms counted
+// from the start of the capture. Replaying it feeds the same bytes back through
+// handleRobotMessage() at the recorded times, so a match can be watched again on the panel.
+// The frames aren't reproducible on the board (dynamic reads the LIS3DH and random()), so
+// nothing is hashed.
+
+// captureStart / captureStop: record complete Serial1 lines into RAM (start clears the buffer)
+void captureStart();
+void captureStop();
+
+// captureLine: called by the Serial1 readers with each non-blank line
+void captureLine(const char *line);
+
+// captureDump: print the recorded trace in the text format above
+void captureDump();
+
+// replayStart: feed the captured trace back in, starting now
+void replayStart();
+
+// robotInput: Serial1, or the replayed trace while a replay runs; writes to it are dropped then
+Stream &robotInput();
+
+// replayFrame: from show(); counts frames while a replay runs and ends it after the tail
+void replayFrame();
+
+// captureFrameDump: print the canvas as "P <frame> <row> <hex565...>" rows
+void captureFrameDump(const uint16_t *pixels, uint16_t w, uint16_t h, uint32_t frame);
+
+// captureReport: recording/replay state and buffer use
+void captureReport();
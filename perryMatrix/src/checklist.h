@@ -4,16 +4,20 @@
 #include <Arduino.h>
 #include <Stream.h>
 #include <stdint.h>
+#include "message.h"
 
 // drawChecklistStatic: render the full checklist (header, items with boxes, bottom status)
 void drawChecklistStatic();
 
-// processChecklistPayload: parse CSV flags, update boxes and ready status, animate changes
-void processChecklistPayload(const char* payload);
+// processChecklistMessage: apply parsed checklist flags, update boxes and ready status, animate changes
+void processChecklistMessage(const ChecklistMsg &msg);
 
 // readAndProcess: read a line from stream, log it and process the payload
 void readAndProcess(Stream &in, const char *label);
 
+// drawBoxColumn: draw one column of the box at given index (no show)
+void drawBoxColumn(uint8_t idx, uint8_t col, uint16_t color);
+
 // sweepBoxLR: animate box fill left→right at given index
 void sweepBoxLR(uint8_t idx, uint16_t color);
 
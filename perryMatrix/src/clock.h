@@ -0,0 +1,37 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+// Every animation timer, hold and delay reads time through these functions. Measurements of
+// how long code takes (benchmarks, latency stamps, the profiler) keep using the hardware
+// counters, so they still report real cost when the clock is simulated.
+#ifndef CLOCK_VIRTUAL
+#ifdef ARDUINO
+#define CLOCK_VIRTUAL 0
+#else
+#define CLOCK_VIRTUAL 1 //host builds run on simulated time; set to 0 to use the system clock
+#endif
+#endif
+
+#if CLOCK_VIRTUAL
+// clockMillis / clockMicros: simulated time; it only moves when something waits or advances it
+unsigned long clockMillis();
+unsigned long clockMicros();
+
+// clockDelay: skip 'ms' of simulated time at once
+void clockDelay(unsigned long ms);
+
+// clockWaitMicros: jump to 'until' if it's still ahead (wrap safe)
+void clockWaitMicros(unsigned long until);
+
+// clockAdvance: move simulated time forward by 'us', e.g. one frame between loop() passes
+void clockAdvance(unsigned long us);
+#else
+inline unsigned long clockMillis() { return millis(); }
+inline unsigned long clockMicros() { return micros(); }
+inline void clockDelay(unsigned long ms) { delay(ms); }
+inline void clockWaitMicros(unsigned long until) {
+  while ((long)(micros() - until) < 0) {}
+}
+#endif
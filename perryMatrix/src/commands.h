@@ -0,0 +1,9 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+#include "rxstats.h"
+
+// handleDebugCommand: run a '?'-prefixed diagnostic command (e.g. "?blit") that arrived on 'src';
+// returns false for normal lines
+bool handleDebugCommand(const char *line, RxSource src);
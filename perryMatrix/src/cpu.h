@@ -0,0 +1,27 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+#include "globals.h"
+
+// per-mode sliding window: CPU_BUCKETS buckets of CPU_BUCKET_MS of that mode's own run time
+#define CPU_BUCKETS    8
+#define CPU_BUCKET_MS  250
+
+// cpuInit: calibrate the idle-loop gap threshold and a baseline refresh-ISR share (panel running)
+void cpuInit();
+
+// cpuDelay: drop-in for delay() that counts the wait as idle and samples ISR time while spinning
+void cpuDelay(unsigned long ms);
+
+// cpuWaitMicros: spin until micros() reaches 'until' (wrap safe), counted like cpuDelay
+void cpuWaitMicros(unsigned long until);
+
+// cpuSleepUntil: WFI until micros() reaches 'until' or wake() returns true; counted as idle
+void cpuSleepUntil(unsigned long until, bool (*wake)());
+
+// cpuTick: once per loop(); charges the time since the last tick to 'mode'
+void cpuTick(Mode mode);
+
+// cpuReport: per-mode isr/loop/idle percentages over each mode's window plus the worst loop gap
+void cpuReport();
@@ -0,0 +1,78 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <Adafruit_Protomatter.h>
+
+// portrait draw surface: the panel is mounted on its side, so everything is drawn
+// into a native 32x128 canvas and turned into the panel's 128x32 layout once per show()
+class PerryDisplay : public GFXcanvas16 {
+public:
+  // PerryDisplay: portrait canvas that presents through the given protomatter panel
+  PerryDisplay(Adafruit_Protomatter &out);
+
+  // begin: start the panel driver; the canvas itself needs no setup
+  ProtomatterStatus begin();
+
+  // show: transpose the portrait canvas into the panel buffer, hold it to the current limit
+  // (power.h) and push it out
+  void show();
+
+  // present: transpose only (no panel refresh); show() minus the protomatter conversion
+  void present();
+
+  // saveCanvas / restoreCanvas: park the canvas in the panel buffer, which show() rewrites
+  // whole, so a bench can draw over the live frame and hand it back unchanged; nothing in
+  // between may call show() or present()
+  void saveCanvas();
+  void restoreCanvas();
+
+  // primitives below clip to the canvas before rasterizing and write the buffer directly;
+  // output is pixel-identical to the GFX versions, which they fall back to when clipFast is off
+
+  // drawPixel: counted so the GFX fallbacks report how many pixels they touched
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+
+  // drawFastVLine / drawFastHLine / fillRect: clip the span or rect once, then fill rows
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override;
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override;
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override;
+
+  // drawLine: bresenham entered directly at the first visible step and stopped after the last
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) override;
+
+  // drawCircle / fillCircle: midpoint walk that only emits octants and spans inside the canvas
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+
+  // clipFast: analytic clipping on (default) or plain GFX rasterizing for comparison
+  bool clipFast = true;
+
+  // pixelVisits: pixels generated by primitives (visible or not) since the caller last zeroed it
+  uint32_t pixelVisits = 0;
+
+  // shows: frames pushed to the panel since boot
+  uint32_t shows = 0;
+
+  // offscreen: show() returns at once and the panel keeps its last frame (?bench renders so)
+  bool offscreen = false;
+
+  // color565: same packing as the panel so existing colour math is unchanged
+  static uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+    return Adafruit_Protomatter::color565(r, g, b);
+  }
+
+private:
+  Adafruit_Protomatter &panel;
+
+  // fastPath: the direct writes index the buffer as _width x _height, true only unrotated
+  bool fastPath() const { return clipFast && rotation == 0; }
+
+  // span / rect fills clipped to the canvas; direct buffer writes
+  void clippedVLine(int16_t x, int32_t y, int32_t h, uint16_t color);
+  void clippedRect(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+};
+
+// benchPrimitives: primitive throughput through the rotated panel canvas vs the native canvas
+void benchPrimitives();
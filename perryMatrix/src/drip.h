@@ -0,0 +1,60 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+// pending lines per source and the longest line kept
+#define DRIP_QUEUE_LEN  8
+#define DRIP_LINE_LEN   64
+
+// frames costing more than this (ms, smoothed) mean rendering is the bottleneck: coalesce
+#define DRIP_HEAVY_MS   20
+
+// how a line relates to the one before it in the stream
+enum DripKind : uint8_t {
+  DRIP_LEVEL,        // same mode, same edge fields: a newer level update supersedes it
+  DRIP_EDGE,         // same mode, an edge field changed (intake, score, climb, all-ready)
+  DRIP_TRANSITION,   // different mode
+  DRIP_COMMAND,      // '?' diagnostic
+  DRIP_MALFORMED     // no mode digit; never coalesces, dispatch counts it in rxMalformed
+};
+
+struct DripLine {
+  char          text[DRIP_LINE_LEN];
+  unsigned long byteUs, lineUs;   // latency stamps of the line that ended up in this slot
+  uint8_t       kind;
+};
+
+// DripQueue: arrival-ordered pending lines for one serial source
+struct DripQueue {
+  DripLine line[DRIP_QUEUE_LEN];
+  uint8_t  head, count;
+  int8_t   lastMode;               // stream state after the newest queued line
+  uint16_t lastSig;
+  uint32_t received, coalesced, forced;
+};
+
+// dripClassify: kind of 'text' given the stream state; updates lastMode/lastSig
+uint8_t dripClassify(DripQueue &q, const char *text);
+
+// dripFull: no room for another line; the caller dispatches dripTake() first (never drops)
+bool dripFull(const DripQueue &q);
+
+// dripPush: queue a complete line; a level update collapses into a queued level update when coalescing
+void dripPush(DripQueue &q, const char *text, unsigned long byteUs, unsigned long lineUs, bool coalesce);
+
+// dripTake: oldest pending line, unconditionally
+bool dripTake(DripQueue &q, DripLine &out);
+
+// dripPop: next line for this poll; a transition or edge ends the poll so it gets its own frame
+bool dripPop(DripQueue &q, DripLine &out, uint8_t &budget);
+
+// dripNoteLoad: feed the last frame's cost once per pass (pacerFrameCost(), which leaves out the
+// pacer's sleep); returns true while rendering is slow enough to coalesce
+bool dripNoteLoad(uint32_t frameUs);
+
+// dripBudget: lines to dispatch per poll at the current load
+uint8_t dripBudget();
+
+// benchDrip: replay bursty traces through the policy and check no transition or edge is lost
+void benchDrip();
@@ -1,12 +1,32 @@
 // © 2025 SC5K Systems
 #pragma once
 #include <stdint.h>
+#include "message.h"
+
+// dynamicSensorBegin: start i2c and probe the accelerometer; only the first call does anything,
+// so autonomous mode can run it ahead of the switch and initDynamic() finds it done
+void dynamicSensorBegin();
 
 // initDynamic: init i2c accelerometer, seed node network, reset filters and flags
 void initDynamic();
 
-// updateDynamicFromPayload: parse req,intake,score,climb flags (new format) or legacy accel,ai,cube; update dynamic UI and handle edge detection
-void updateDynamicFromPayload(const char* payload);
+// updateDynamicFromMessage: apply parsed req,intake,score,climb flags (new format) or legacy accel,ai,cube; update dynamic UI and handle edge detection
+void updateDynamicFromMessage(const Message &msg);
 
 // runDynamicFrame: render dynamic mode (network, accel strip, AI/on boxes, request banners, optional cube)
 void runDynamicFrame();
+
+// reportDynamicAnim: print climb celebration playback stats (frames shown/dropped, lateness)
+void reportDynamicAnim();
+
+// updateScoreBars: one random-walk step of the score meter bars toward the current level
+void updateScoreBars();
+
+// segIntersect: true if segment (x1,y1)-(x2,y2) properly crosses (x3,y3)-(x4,y4)
+bool segIntersect(int x1, int y1, int x2, int y2,
+                  int x3, int y3, int x4, int y4);
+
+// rotProj: rotate a unit-cube vertex by pitch/roll and project it to screen coords around (cx,cy)
+void rotProj(const float in[3], float pitch, float roll,
+             int16_t& sx, int16_t& sy,
+             int16_t cx, int16_t cy);
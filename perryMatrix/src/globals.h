@@ -22,8 +22,8 @@ extern Mode currentMode, lastMode;
 // dynamic mode config: segment heights, node array, LIS3DH and cube parameters
 struct Node { int16_t x, y; int8_t dx, dy; };
 extern const int16_t SEG_TOP_H, SEG_MID_H, SEG_BOT_H;
-extern const uint8_t NODE_COUNT;
-extern Node       nodes[];
+#define NODE_COUNT 12
+extern Node *const nodes;       // in the mode arena (arena.h)
 extern uint8_t    netFrame;
 extern Adafruit_LIS3DH lis;
 extern const float SMOOTHING, ANGLE_THRESHOLD;
@@ -61,40 +61,42 @@ extern bool          perryActive;
 extern int           lastSponsor;
 extern const char*   perryLines4[];
 extern const uint8_t perryLineCount4;
-extern uint8_t       perryLens4[];
-extern bool          perryDec[][16];
-extern uint8_t       perryDone[], perryWriteIdx4[];
+extern uint8_t *const perryLens4;          // these four live in the mode arena (arena.h)
+extern bool   (*const perryDec)[16];
+extern uint8_t *const perryDone, *const perryWriteIdx4;
 extern unsigned long p_lastUpdate, p_lastObf, p_startObf, p_finalHold;
 extern bool          p_writing, p_decrypting;
 extern uint8_t       p_linesDone;
 extern int16_t       p_yStart, p_lineGap;
 
-// audio visualizer state and config: FFT, flags, timing, sample buffers, bar metrics, peaks and smoothing
-extern ArduinoFFT<double> FFT;
+// audio visualizer state and config: FFT, flags, timing, sample buffers, bar metrics, peaks and smoothing.
+// single precision runs on the M4's FPU; the sample buffers live in the mode arena (arena.h)
+#define FFT_SAMPLES 512
+extern ArduinoFFT<float>  FFT;
 extern bool               audioActive;
 extern unsigned long      audioStartTime;
-extern const unsigned long audioDuration;
+extern unsigned long      audioDuration;
 extern const uint16_t     samples;
 extern const double       samplingFrequency;
 extern const unsigned long sampleDelay;
-extern double             vReal[], vImag[];
+extern float *const       vReal, *const vImag;
 extern int                barHeights[];
 extern bool               redlined[];
 extern int                peakLevels[];
 extern unsigned long      peakTimes[];
-extern const int          smoothingFactor;
-extern double             smoothedInput[];
+extern int                smoothingFactor;
+extern float *const       smoothedInput;
 extern const int          WAVE_X_SHIFT;
 
 // timing and layout constants for boot/animations/checklist: delays, counts, speeds and spacing
 extern const unsigned long bootDelay,
                             dashDelayBefore,
                             dashedPhaseDuration,
-                            typeDelay,
                             postOptionsDelay,
                             flashDelay,
                             hueCycleDuration,
-                            postChecklistDelay,
+                            postChecklistDelay;
+extern unsigned long      typeDelay,     // tunable (params.h)
                             boxDelay;
 extern const uint8_t      flashCount;
 extern const uint16_t     animDelayP,
@@ -103,10 +105,9 @@ extern const uint16_t     animDelayP,
                             pauseP,
                             loadDurP,
                             writeDelayP;
-extern const int          SCROLL_SPEED,
-                            FRAME_DELAY;
-extern const uint8_t      HUE_DELTA,
-                            SEP_Y;
+extern int                scrollSpeed;
+extern uint8_t            hueDelta;
+extern const uint8_t      SEP_Y;
 extern const uint8_t      topSpacing,
                             betweenSetupAndPiece,
                             textBoxGap,
@@ -118,8 +119,6 @@ extern const uint8_t      topSpacing,
 // autonomous mode config: timers, intervals, state flags, text and geometry
 extern unsigned long autoTextPrev,
                      textInterval,
-                     autoStarPrev,
-                     starInterval,
                      startTime,
                      animationDuration;
 extern bool        autoState, autoActive;
@@ -127,9 +126,9 @@ extern const char* line1, *line2;
 extern int16_t     tX1, tX2, tY1, tY2, boxX, boxY, boxW, boxH;
 
 // starfield: star struct/array and dynamic circle radii
-#define MAX_STARS 50
+#define MAX_STARS 150
 struct Star { int16_t xInt, yInt; float accX, accY, stepX, stepY; };
-extern Star   stars[];
+extern Star *const stars;   // in the mode arena (arena.h)
 extern const int DYN_CIRCLES, maxDynRadius;
 extern int   dynRadius[];
 
@@ -152,5 +151,5 @@ extern uint16_t     dynAiInterval;
 // serial line buffer: 64-byte storage for incoming commands
 extern char lineBuf[64];
 
-// dripFeedMode flag: when true, process only the latest complete serial line per loop
+// dripFeedMode flag: when true, queue serial lines and coalesce level updates (never mode changes or edges)
 extern bool dripFeedMode;
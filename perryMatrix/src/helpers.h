@@ -28,6 +28,12 @@ inline void shuffleArray(uint16_t *arr, uint16_t n) {
   }
 }
 
+// lfsr12: next state of a full-period 12-bit galois lfsr (taps 12,11,10,4); from any
+// non-zero state it visits every value 1..4095 once before repeating
+inline uint16_t lfsr12(uint16_t s) {
+  return (s >> 1) ^ ((0u - (s & 1u)) & 0xE08u);
+}
+
 // hsvToRgb: convert HSV (0–360°,0–1,0–1) to 0–255 RGB values
 inline void hsvToRgb(float h, float s, float v,
                      uint8_t &r, uint8_t &g, uint8_t &b) {
@@ -0,0 +1,65 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+#include "globals.h"
+
+#ifndef JOURNAL_ENABLED
+#define JOURNAL_ENABLED 1 //set to 0 to leave the QSPI flash untouched
+#endif
+
+// journal region: JOURNAL_SECTORS 4 KB sectors near the top of the QSPI flash, used as a ring (see storage.h)
+#define JOURNAL_SECTORS     64
+#define JOURNAL_SECTOR_SIZE 4096
+#define JOURNAL_PAGE_SIZE   256
+// RAM staging between journalEvent() and the flash (bytes, power of two)
+#define JOURNAL_RING_SIZE   2048
+// a partial page is programmed once its oldest event has waited this long (ms)
+#define JOURNAL_FLUSH_MS    1000
+// a loop pass longer than this is journaled as an overrun (ms)
+#define JOURNAL_OVERRUN_MS  50
+
+// event types; 0xFF is erased flash and ends a sector
+enum JournalType : uint8_t {
+  JEV_SECTOR    = 0x01,  // first record of every sector: ms holds the sector sequence number
+  JEV_BOOT      = 0x02,
+  JEV_MODE      = 0x03,  // a = previous mode, b = new mode
+  JEV_CHECKLIST = 0x04,  // a = checklist bits (1 = green), b = item count
+  JEV_DYNAMIC   = 0x05,  // a = req | intake << 1, b = score, c = climb
+  JEV_LEGACY    = 0x06,  // a = accel | ai << 1 | cube << 2
+  JEV_DROP      = 0x07,  // a = source (0 USB, 1 Serial1), b = JournalDrop reason
+  JEV_OVERRUN   = 0x08,  // a/b = loop pass ms (low/high byte), c = mode
+  JEV_END       = 0xFF
+};
+
+// why a received line never reached its handler
+enum JournalDrop : uint8_t {
+  JDROP_OVERFLOW,    // longer than the receive buffer
+  JDROP_COALESCED    // replaced by a newer level update (drip feed)
+};
+
+// JournalEvent: one fixed 8-byte record, little endian as stored
+struct JournalEvent {
+  uint32_t ms;
+  uint8_t  type, a, b, c;
+};
+
+// journalInit: find the newest sector, start a fresh one after it and log a boot event
+void journalInit();
+
+// journalEvent: stamp and queue one record; never touches the flash
+void journalEvent(uint8_t type, uint8_t a = 0, uint8_t b = 0, uint8_t c = 0);
+
+// journalSuspend: while on, journalEvent() records nothing; ?bench and ?mb drive the modes
+// with made-up messages that are not match events
+void journalSuspend(bool on);
+
+// journalFrame: once per loop pass; journals overruns and starts at most one erase or page
+// program, and only when the flash isn't busy, so it never waits on the chip
+void journalFrame(Mode mode);
+
+// journalDump: stream every stored event, oldest first, as text over USB
+void journalDump();
+
+// journalReport: flash position, queue depth, write counts and cost
+void journalReport();
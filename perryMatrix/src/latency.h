@@ -0,0 +1,24 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+// a line may start with "#<seq> " ahead of "<mode> <payload>". such lines are traced from
+// their first byte to the first show() after they were applied, and the firmware answers on
+// Serial1 with "@<seq> <total> <byte-line> <line-parse> <parse-apply> <apply-show>" (all us)
+
+// traced lines that can wait for the same show(); a burst longer than this loses its oldest
+#define TRACE_SLOTS 8
+
+// traceBegin: strip an optional "#seq" token and stamp byte/line/parse times; returns the rest
+char *traceBegin(char *line, unsigned long byteUs, unsigned long lineUs);
+
+// traceApplied: the line from the last traceBegin() is applied; arm the next show()
+void traceApplied();
+
+// traceShown: called from show(); completes and echoes every armed trace, oldest first. an
+// echo is only written when it fits in Serial1's TX buffer; the rest are counted, not sent
+void traceShown();
+
+// reportLatency: last traced line's stage breakdown, how many were echoed, lost or not sent
+void reportLatency();
@@ -0,0 +1,50 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+// log levels, most to least severe
+#define LOG_LEVEL_ERROR 0
+#define LOG_LEVEL_WARN  1
+#define LOG_LEVEL_INFO  2
+#define LOG_LEVEL_DEBUG 3
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO //calls above this level compile to nothing
+#endif
+
+// ring size in bytes (power of two) and most bytes handed to USB per drain
+#define LOG_RING_SIZE  1024
+#define LOG_DRAIN_MAX  128
+
+// logLine: queue "<label><text>\n"; the whole record is dropped (and counted) if it doesn't fit
+void logLine(const char *label, const char *text);
+
+// logPrintf: format into a short stack buffer, then queue like logLine
+void logPrintf(const char *fmt, ...);
+
+// logDrain: write what USB will take without blocking, at most LOG_DRAIN_MAX bytes; call once a frame
+void logDrain();
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) logPrintf(__VA_ARGS__)
+#else
+#define LOG_ERROR(...) ((void)0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(...) logPrintf(__VA_ARGS__)
+#else
+#define LOG_WARN(...) ((void)0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...) logPrintf(__VA_ARGS__)
+#define LOG_INFO_LINE(label, text) logLine(label, text)
+#else
+#define LOG_INFO(...) ((void)0)
+#define LOG_INFO_LINE(label, text) ((void)0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) logPrintf(__VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
@@ -4,6 +4,7 @@
 #include <Arduino.h>           // pinMode, A1/A2, etc.
 #include <Adafruit_GFX.h>
 #include <Adafruit_Protomatter.h>
+#include "display.h"
 
 // matrix dimensions (pixels)
 #define WIDTH   128
@@ -25,8 +26,12 @@ extern uint8_t rgbPins[];
 extern uint8_t addrPins[];
 extern uint8_t clockPin, latchPin, oePin;
 
-// shared serial buffer pointer (allocated in .cpp)
-extern char *buf;
+// shared serial line buffer, static so nothing is left on the heap after boot
+#define BUF_SIZE 32
+extern char buf[BUF_SIZE];
 
-// primary matrix object constructed with WIDTH×HEIGHT
-extern Adafruit_Protomatter matrix;
+// protomatter panel driver constructed with WIDTH×HEIGHT (landscape, as wired)
+extern Adafruit_Protomatter panel;
+
+// portrait draw surface (HEIGHT×WIDTH) every mode renders into; show() presents it on the panel
+extern PerryDisplay matrix;
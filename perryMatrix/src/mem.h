@@ -0,0 +1,18 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+// points in startup where the heap is sampled
+enum MemMark : uint8_t {
+  MEM_START,    // setup() entry, before any driver allocates
+  MEM_PANEL,    // after matrix.begin(): protomatter's buffers are on the heap
+  MEM_BOOT,     // the boot animation ended
+  MEM_MARKS
+};
+
+// memMark: record the heap break, bytes in use and the stack-to-heap gap at a mark
+void memMark(MemMark mark);
+
+// memReport: every mark, the current figures and the high-water of the heap break
+void memReport();
@@ -0,0 +1,70 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+// most payload fields any schema declares
+#define MSG_MAX_FIELDS 4
+
+// payload layouts: one byte per field, in wire order, so the parser fills them in place
+struct ChecklistMsg {
+  uint8_t state[MSG_MAX_FIELDS];         // 1 = green, 0 = red, one per checklist item
+};
+
+struct DynamicMsg {
+  uint8_t req, intake, score, climb;     // request flag, intake flag, score level, climb state
+};
+
+struct DynamicLegacyMsg {
+  uint8_t accel, ai, cube;               // old three-flag teleop format
+};
+
+// which struct the payload union holds
+enum PayloadFormat : uint8_t {
+  PAYLOAD_NONE,        // mode only, or a mode without a schema
+  PAYLOAD_CHECKLIST,
+  PAYLOAD_DYNAMIC,
+  PAYLOAD_DYNAMIC_LEGACY
+};
+
+// FieldSpec: accepted range of one field; out-of-range values are clamped
+struct FieldSpec {
+  uint8_t min, max;
+};
+
+// MessageSchema: payload description for one mode and field count range
+struct MessageSchema {
+  int8_t           mode;
+  uint8_t          minFields, maxFields;  // accepted field count; 'fields' covers the first MSG_MAX_FIELDS
+  uint8_t          format;
+  const FieldSpec *fields;
+};
+
+// Message: one parsed line. nothing is copied out of the receive buffer except the
+// numeric fields themselves, which land directly in the typed payload.
+struct Message {
+  bool        command;        // "?..." diagnostic; 'body' points at it
+  bool        hasMode;        // a mode token was found
+  int8_t      mode;
+  uint8_t     format;         // PayloadFormat of 'payload'
+  uint8_t     fieldCount;     // payload fields present on the wire
+  const char *body;           // line after spaces and any "#seq" token
+  union {
+    ChecklistMsg     checklist;
+    DynamicMsg       dynamic;
+    DynamicLegacyMsg legacy;
+    uint8_t          raw[MSG_MAX_FIELDS];
+  } payload;
+};
+
+// parseMessage: single pass over 'body' (already past any "#seq"); false if there is no mode
+bool parseMessage(const char *body, Message &out);
+
+// parsePayload: parse the CSV after the mode token into 'out' using 'mode's schema; false if none fits
+bool parsePayload(const char *payload, int8_t mode, Message &out);
+
+// messageEqual: payload comparison for change detection (format and fields, not text)
+bool messageEqual(const Message &a, const Message &b);
+
+// benchParse: lines/ms through parseMessage vs the old strtol/strncpy/atoi chain
+void benchParse();
@@ -0,0 +1,54 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+#include "globals.h"
+#include "message.h"
+
+// ModeOps: what a display mode does; the loop and both serial dispatch paths go through these.
+// any hook may be null
+struct ModeOps {
+  const char *name;
+  void (*enter)(const Message &msg);   // set up; msg is the line that switched to the mode
+  void (*update)(const Message &msg);  // a line for the mode that is already running
+  void (*frame)();                     // once per frame
+  void (*exit)();                      // before the next mode's enter
+  void (*prewarm)();                   // slow setup that draws nothing, run ahead of the switch
+  uint8_t *fps;                        // target frame rate (pacer.h); null or 0 runs frame every pass
+};
+
+// per-mode tables (the registry, pacer and cpu stats) are indexed by slot, mode + 1;
+// slot 0 is MODE_NULL, the boot animation before the first robot message
+#define MODE_SLOTS 5
+
+// modeSlot: table slot of 'mode', or MODE_SLOTS for a mode number with no entry
+inline uint8_t modeSlot(int8_t mode) {
+  uint8_t slot = (uint8_t)(mode + 1);
+  return slot < MODE_SLOTS ? slot : MODE_SLOTS;
+}
+
+// modeName: the registry's name for 'mode' ("boot" for MODE_NULL, "unknown" off the table)
+const char *modeName(int8_t mode);
+
+// per-mode target frame rates, tunable with ?set (params.h)
+extern uint8_t checklistFps, autonomousFps, dynamicFps, shutdownFps;
+
+// frames a mode runs before the next mode in match order is pre-warmed
+#define MODE_PREWARM_FRAMES 30
+
+// modeDispatch: apply a parsed robot message: switch modes, or hand it to the running mode
+void modeDispatch(const Message &msg);
+
+// modeFrame: run the current mode's frame if the pacer has one due; also pre-warms the
+// predicted next mode and stamps switch latency once the new mode has shown a frame
+void modeFrame();
+
+// modeRetarget: re-read the running mode's frame rate after it was changed
+void modeRetarget();
+
+// modeRestore: start the running mode over from its last line, after something else (?bench)
+// has drawn into the canvas and taken the arena
+void modeRestore();
+
+// modeReport: switch latency per transition (count, last, worst) and pre-warm state
+void modeReport();
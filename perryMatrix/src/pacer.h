@@ -0,0 +1,43 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+#include "globals.h"
+
+#ifndef PACER_ENABLED
+#define PACER_ENABLED 1 //set to 0 to render on every loop pass and never sleep, as before
+#endif
+
+// a frame that costs more than its period this many times in a row halves (then thirds,
+// quarters) the mode's frame rate; frames that would fit the faster rate with a quarter
+// to spare, this many in a row, step it back up
+#define PACER_DEGRADE_FRAMES 8
+#define PACER_RECOVER_FRAMES 60
+#define PACER_MAX_DIVISOR    4
+
+// pacerInit: select idle sleep for WFI
+void pacerInit();
+
+// pacerTarget: pace 'mode' at 'fps' from now on; 0 renders every pass and never sleeps
+void pacerTarget(Mode mode, uint8_t fps);
+
+// pacerKick: make the next frame due at once, so a robot line is drawn in the pass it arrives
+void pacerKick();
+
+// pacerFrameDue: true when this pass should render; marks the start of the frame
+bool pacerFrameDue();
+
+// pacerFrameEnd: after the frame: cost, missed deadlines (skipped, not caught up) and degrade
+void pacerFrameEnd();
+
+// pacerFrameCost: us the last frame took from pacerFrameDue() to pacerFrameEnd(), sleep excluded
+uint32_t pacerFrameCost();
+
+// pacerIdle: end of loop(); sleep until the next frame is due or a serial byte arrives
+void pacerIdle();
+
+// pacerEnable: switch pacing on or off at run time (?pace on|off)
+void pacerEnable(bool on);
+
+// pacerReport: per mode target and achieved fps, frame cost, overruns, skips, current divisor
+void pacerReport();
@@ -0,0 +1,46 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+// live-tunable parameters: timing and load knobs that used to need a reflash. each entry
+// points at the variable the code already reads, so a ?set takes effect on the next use
+enum ParamType : uint8_t {
+  PARAM_BOOL,
+  PARAM_U8,
+  PARAM_U16,
+  PARAM_INT,
+  PARAM_ULONG
+};
+
+struct Param {
+  const char *name;
+  ParamType   type;
+  void       *value;
+  int32_t     min, max;
+  void      (*changed)();   // after a set, for values copied elsewhere; may be null
+  const char *help;
+};
+
+// paramLoad: note the built-in defaults, then apply the values saved in settings; call once
+// settingsLoad() has run
+void paramLoad();
+
+// paramFind: registry entry by name, or null
+const Param *paramFind(const char *name);
+
+// paramGet: current value
+int32_t paramGet(const Param &p);
+
+// paramSet: clamp-checked set; false if the value is outside the entry's range
+bool paramSet(const Param &p, int32_t value);
+
+// paramReset: back to the built-in default
+void paramReset(const Param &p);
+
+// paramList: every entry with value, default, range and help
+void paramList();
+
+// paramSave: store the values that differ from the defaults in settings and write them to
+// flash; blocks on the sector erase like settingsSave()
+bool paramSave();
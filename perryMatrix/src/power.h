@@ -0,0 +1,27 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+#ifndef POWER_LIMIT_MA
+#define POWER_LIMIT_MA 2500 //LED supply budget in mA; 0 turns the limiter off, the estimate still runs
+#endif
+
+// panel current model: one colour channel of one pixel at full value draws POWER_UA_PER_CHANNEL
+// averaged over the 1/16 scan (a 64x32 panel at full white is about 4 A); the drivers and the
+// board draw POWER_BASE_MA on top of that with every pixel dark
+#define POWER_UA_PER_CHANNEL 650
+#define POWER_BASE_MA        180
+
+// powerFrame: estimate what a finished panel frame draws and scale it down through a channel
+// lookup table when it is over the limit; from show(), just before the bitplane conversion
+void powerFrame(uint16_t *frame, uint16_t n);
+
+// powerLimitMa: ceiling in mA (0 = no limit); powerBrightness: global brightness, 255 = full,
+// which the limiter only ever dims below. both are tunable (params.h)
+extern uint16_t powerLimitMa;
+extern uint8_t  powerBrightness;
+
+// powerReport: last frame lit pixels and estimated mA before/after the limit, peak, limited
+// frames, and what the estimate costs per frame
+void powerReport();
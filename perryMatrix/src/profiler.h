@@ -0,0 +1,61 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1 //set to 0 to compile every PROFILE_SCOPE out
+#endif
+
+// fixed table sizes: distinct scope sites, (site, parent) nodes, nesting depth
+#define PROF_MAX_SITES  16
+#define PROF_MAX_NODES  24
+#define PROF_MAX_DEPTH  8
+
+// latency histogram: 4 buckets per power of two from 2^PROF_HIST_MIN_LOG2 ticks up
+#define PROF_HIST_MIN_LOG2  4
+#define PROF_HIST_OCTAVES   24
+#define PROF_HIST_BINS      (PROF_HIST_OCTAVES * 4)
+
+// profInit: start the cycle counter (DWT on target, steady_clock on host)
+void profInit();
+
+// profNow: current tick count; cycles on target, nanoseconds on host
+uint32_t profNow();
+
+// profRegister: claim a site id for a scope name (once per call site)
+uint8_t profRegister(const char *name);
+
+// profEnter: make this site's node under the current scope current; returns the node to restore
+uint8_t profEnter(uint8_t site);
+
+// profExit: record elapsed ticks for the current node and pop back to 'outer'
+void profExit(uint8_t outer, uint32_t ticks);
+
+// profReport: print the scope tree with calls, min/mean/p99/max in microseconds
+void profReport();
+
+// profReset: clear all statistics (sites and tree shape are kept)
+void profReset();
+
+// ProfileScope: times its own lifetime against the node entered in the constructor
+class ProfileScope {
+public:
+  explicit ProfileScope(uint8_t site) : outer(profEnter(site)), start(profNow()) {}
+  ~ProfileScope() { profExit(outer, profNow() - start); }
+private:
+  uint8_t  outer;
+  uint32_t start;
+};
+
+#define PROF_CAT2(a, b) a##b
+#define PROF_CAT(a, b)  PROF_CAT2(a, b)
+
+#if PROFILER_ENABLED
+// PROFILE_SCOPE: time the rest of the enclosing block under 'name'
+#define PROFILE_SCOPE(name) \
+  static const uint8_t PROF_CAT(profSite_, __LINE__) = profRegister(name); \
+  ProfileScope PROF_CAT(profScope_, __LINE__)(PROF_CAT(profSite_, __LINE__))
+#else
+#define PROFILE_SCOPE(name) do {} while (0)
+#endif
@@ -0,0 +1,33 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+enum RxSource : uint8_t { RX_USB, RX_SERIAL1, RX_SOURCES };
+
+// RxStats: what the line readers did with one source's bytes
+struct RxStats {
+  uint32_t bytes;       // every byte read, CR/LF included
+  uint32_t lines;       // newlines seen
+  uint32_t truncated;   // lines longer than the reader's buffer (dispatched cut short)
+  uint32_t lostBytes;   // bytes cut from those lines
+  uint32_t coalesced;   // lines the drip feed replaced with a newer one
+};
+
+extern RxStats  rxStats[RX_SOURCES];
+extern uint32_t rxMalformed;   // dispatched lines with neither a mode nor a '?' command
+
+// rxByte: count one byte read from 'src'
+inline void rxByte(uint8_t src) { rxStats[src].bytes++; }
+
+// rxOverflowByte: a byte didn't fit the line buffer; true for the first one of the line
+bool rxOverflowByte(uint8_t src, bool &overflow);
+
+// rxLineEnd: a newline arrived; count it and re-arm overflow detection
+void rxLineEnd(uint8_t src, bool &overflow);
+
+// rxReport: per-source counters, bytes/s since the last reset and the malformed count, to 'out'
+void rxReport(Print &out);
+
+// rxReset: zero every counter
+void rxReset();
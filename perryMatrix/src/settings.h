@@ -0,0 +1,34 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+// settings record: stored at the start of the settings sector, rewritten whole on save
+#define SETTINGS_MAGIC   0x534D5050UL   // "PPMS"
+#define SETTINGS_VERSION 2
+#define SETTINGS_PARAMS  30
+
+// a tuned parameter (params.h), keyed by a hash of its name so the registry can change order
+struct SettingsParam {
+  uint16_t key;           // 0 = unused slot
+  uint16_t reserved;
+  int32_t  value;
+};
+
+struct Settings {
+  uint32_t magic;
+  uint8_t  version;
+  uint8_t  fastBoot;      // 1 = skip the boot animation and draw the checklist at once
+  uint8_t  paramCount;
+  uint8_t  reserved;
+  SettingsParam params[SETTINGS_PARAMS];
+};
+
+extern Settings settings;
+
+// settingsLoad: read the stored record, or fall back to defaults if it is blank or stale
+void settingsLoad();
+
+// settingsSave: erase the settings sector and program the current record; blocks for the
+// erase (tens of ms), so only call it from a command, never from a frame
+bool settingsSave();
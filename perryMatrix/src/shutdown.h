@@ -7,3 +7,6 @@ void initShutdown();
 
 // runShutdownFrame: draw header and scroll fake code
 void runShutdownFrame();
+
+// charDelay: ms per typed character of the fake code (tunable, params.h)
+extern unsigned long charDelay;
@@ -0,0 +1,31 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <stdint.h>
+
+// sprite pixel formats: palette indices or raw rgb565 per run
+enum SpriteFormat : uint8_t {
+  SPRITE_INDEXED = 0,
+  SPRITE_RGB565  = 1
+};
+
+// RleSprite: run-length encoded sprite stored in flash (see tools/sprite_conv.py).
+// each row is a list of runs covering exactly w pixels; a header byte with bit7
+// set is an opaque run of (hdr&0x7F)+1 pixels followed by its colour, otherwise
+// a transparent skip of hdr+1 pixels.  rows[] holds the byte offset of each row.
+struct RleSprite {
+  uint8_t         w, h;
+  uint8_t         format;
+  uint8_t         paletteSize;
+  const uint16_t *palette;
+  const uint16_t *rows;
+  const uint8_t  *data;
+};
+
+// blitSprite: draw sprite at (x,y); rows and runs outside the screen are skipped
+// before any pixel is touched.  palette overrides the sprite palette (indexed only)
+void blitSprite(const RleSprite &s, int16_t x, int16_t y,
+                const uint16_t *palette = nullptr);
+
+// benchSpriteBlit: time the intake tube slide-in (sprite vs legacy rects) over serial
+void benchSpriteBlit();
@@ -0,0 +1,10 @@
+// © 2025 SC5K Systems
+// generated by tools/sprite_conv.py -- do not edit by hand
+
+#pragma once
+#include "sprite.h"
+
+// check_box.png: 30x8 indexed, 16 bytes rle (480 raw)
+extern const RleSprite spriteCheckBox;
+// piece_tube.png: 34x64 indexed, 136 bytes rle (4352 raw)
+extern const RleSprite spritePieceTube;
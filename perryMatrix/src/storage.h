@@ -0,0 +1,26 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+#include "journal.h"
+
+// storage region: the top of the QSPI flash. the journal ring fills sectors
+// 0..JOURNAL_SECTORS-1 and the settings record owns the one sector above it
+#define SETTINGS_SECTOR  JOURNAL_SECTORS
+#define STORAGE_SECTORS  (JOURNAL_SECTORS + 1)
+#define STORAGE_BYTES    ((uint32_t)STORAGE_SECTORS * JOURNAL_SECTOR_SIZE)
+
+// storageBegin: bring up the flash once; later calls return the first result
+bool storageBegin();
+
+// storageBusy: true while the chip is still erasing or programming
+bool storageBusy();
+
+// storageErase: start erasing one sector of the region; returns without waiting
+void storageErase(uint16_t sector);
+
+// storageProgram: program n bytes (within one page) at a region offset
+void storageProgram(uint32_t offset, const uint8_t *src, uint32_t n);
+
+// storageRead: read n bytes at a region offset
+void storageRead(uint32_t offset, uint8_t *dst, uint32_t n);
@@ -0,0 +1,55 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <stdint.h>
+
+// fonts held in the glyph atlas: GFX built-in 5x7 (6px advance) and TomThumb (3x5, 4px advance)
+enum TextFont : uint8_t {
+  FONT_5X7      = 0,
+  FONT_TOMTHUMB = 1
+};
+
+// atlas geometry: printable ASCII, 8 rows of up to 8 columns per glyph
+#define TEXT_FIRST_CHAR   32
+#define TEXT_LAST_CHAR    126
+#define TEXT_GLYPH_ROWS   8
+// TomThumb rows are stored from 6 px above the baseline (GFX custom fonts place the cursor on the baseline)
+#define TEXT_TT_BASELINE  6
+// pre-rasterized labels kept by textDrawLabel()
+#define TEXT_LABEL_CACHE  32
+
+// TextLabel: a string pre-rasterized into one 32-bit word per glyph row (bit n = column n)
+struct TextLabel {
+  const char *src;
+  uint32_t    rows[TEXT_GLYPH_ROWS];
+  uint8_t     w;
+  uint8_t     font;
+};
+
+// initTextAtlas: rasterize both fonts once through GFX into packed row masks; call after matrix.begin()
+void initTextAtlas();
+
+// textWidth: advance width of a string in pixels at size 1
+int16_t textWidth(const char *s, TextFont font = FONT_5X7);
+
+// textDraw: draw a string with the atlas blitter (same pixels as setCursor+print); y is the cell top
+// for FONT_5X7 and the baseline for FONT_TOMTHUMB.  size scales each pixel like setTextSize()
+void textDraw(int16_t x, int16_t y, const char *s, uint16_t color,
+              uint8_t size = 1, TextFont font = FONT_5X7);
+
+// textDrawChar: draw a single glyph (e.g. random obfuscation characters)
+void textDrawChar(int16_t x, int16_t y, char c, uint16_t color,
+                  uint8_t size = 1, TextFont font = FONT_5X7);
+
+// textRasterize: pack up to 32 px of a string into a label
+void textRasterize(TextLabel &l, const char *s, TextFont font = FONT_5X7);
+
+// textBlit: draw a pre-rasterized label
+void textBlit(const TextLabel &l, int16_t x, int16_t y, uint16_t color, uint8_t size = 1);
+
+// textDrawLabel: draw a recurring static string from the label cache, rasterizing it on first use
+void textDrawLabel(int16_t x, int16_t y, const char *s, uint16_t color,
+                   uint8_t size = 1, TextFont font = FONT_5X7);
+
+// benchText: compare GFX print against the atlas blitter and cached labels (glyphs/ms) over serial
+void benchText();
@@ -0,0 +1,41 @@
+// © 2025 SC5K Systems
+
+#pragma once
+#include <Arduino.h>
+
+#ifndef TRANSITIONS_ENABLED
+#define TRANSITIONS_ENABLED 1 //set to 0 for hard cuts and 8 KB less RAM
+#endif
+
+// effect used on mode switches, and its length (ms); both can be changed with ?fx
+#define TRANSITION_DEFAULT FX_FADE
+#define TRANSITION_MS      300
+
+enum TransitionKind : uint8_t {
+  FX_CUT,        // no effect
+  FX_FADE,       // crossfade, 16 levels
+  FX_WIPE,       // the new mode sweeps in along the long axis
+  FX_DISSOLVE,   // pixels switch over in a scattered order
+  FX_KINDS
+};
+
+// transitionStart: keep the frame on the panel, before the current limit, as the outgoing
+// image; call as a switch begins, while the canvas still holds the old mode's last frame
+void transitionStart();
+
+// transitionApply: mix the outgoing image into a freshly presented panel frame (landscape,
+// WIDTH x HEIGHT) while a transition runs. the incoming mode renders and shows at its own
+// pace, so its first frame is never held back; it starts out one sixteenth of the way in
+void transitionApply(uint16_t *frame);
+
+// transitionSet: pick the effect and its length; false for an unknown name
+bool transitionSet(const char *name, unsigned long ms);
+
+// transitionReport: current effect and length
+void transitionReport();
+
+// blendFade: dst = from + (dst - from) * level / 16 per channel, two pixels per 32-bit op
+void blendFade(uint16_t *dst, const uint16_t *from, uint16_t n, uint8_t level);
+
+// benchBlend: pixels per microsecond for each effect, and the per-pixel scalar fade for reference
+void benchBlend();
@@ -0,0 +1,87 @@
+// © 2025 SC5K Systems
+
+#include "src/storage.h"
+#include <Arduino.h>
+#include <string.h>
+#include <stdio.h>
+
+// offsets are relative to the start of the storage region
+#ifdef ARDUINO
+#include <Adafruit_SPIFlash.h>
+
+static Adafruit_FlashTransport_QSPI flashTransport;
+static Adafruit_SPIFlash flash(&flashTransport);
+static uint32_t regionBase = 0;
+
+static bool begin() {
+  if (!flash.begin()) return false;
+  if (flash.size() < STORAGE_BYTES) return false;
+  regionBase = flash.size() - STORAGE_BYTES;
+  return true;
+}
+bool storageBusy() {
+  return flash.readStatus() & 0x01;   // WIP bit
+}
+void storageErase(uint16_t sector) {
+  flash.eraseSector(regionBase / JOURNAL_SECTOR_SIZE + sector);
+}
+void storageProgram(uint32_t offset, const uint8_t *src, uint32_t n) {
+  flash.writeBuffer(regionBase + offset, src, n);
+}
+void storageRead(uint32_t offset, uint8_t *dst, uint32_t n) {
+  flash.readBuffer(regionBase + offset, dst, n);
+}
+#else
+// host build: the region is a plain file with NOR semantics (erase sets 0xFF, program only
+// clears bits), so the record format and write pattern match the board byte for byte
+#ifndef STORAGE_HOST_FILE
+#define STORAGE_HOST_FILE "journal.bin"
+#endif
+
+static FILE *file = nullptr;
+
+static bool begin() {
+  file = fopen(STORAGE_HOST_FILE, "r+b");
+  if (!file) {
+    file = fopen(STORAGE_HOST_FILE, "w+b");
+    if (!file) return false;
+  }
+  // a file from before the settings sector existed is short; pad it with erased sectors
+  uint8_t blank[JOURNAL_SECTOR_SIZE];
+  memset(blank, 0xFF, sizeof(blank));
+  fseek(file, 0, SEEK_END);
+  for (long s = ftell(file) / JOURNAL_SECTOR_SIZE; s < STORAGE_SECTORS; s++) {
+    fwrite(blank, 1, sizeof(blank), file);
+  }
+  fflush(file);
+  return true;
+}
+bool storageBusy() {
+  return false;
+}
+void storageErase(uint16_t sector) {
+  uint8_t blank[JOURNAL_SECTOR_SIZE];
+  memset(blank, 0xFF, sizeof(blank));
+  fseek(file, (long)sector * JOURNAL_SECTOR_SIZE, SEEK_SET);
+  fwrite(blank, 1, sizeof(blank), file);
+  fflush(file);
+}
+void storageRead(uint32_t offset, uint8_t *dst, uint32_t n) {
+  fseek(file, offset, SEEK_SET);
+  if (fread(dst, 1, n, file) != n) memset(dst, 0xFF, n);
+}
+void storageProgram(uint32_t offset, const uint8_t *src, uint32_t n) {
+  uint8_t cur[JOURNAL_PAGE_SIZE];
+  storageRead(offset, cur, n);
+  for (uint32_t i = 0; i < n; i++) cur[i] &= src[i];
+  fseek(file, offset, SEEK_SET);
+  fwrite(cur, 1, n, file);
+  fflush(file);
+}
+#endif
+
+bool storageBegin() {
+  static int8_t state = -1;   // -1 not tried, 0 failed, 1 up
+  if (state < 0) state = begin() ? 1 : 0;
+  return state == 1;
+}
@@ -0,0 +1,215 @@
+// © 2025 SC5K Systems
+
+#include "src/text.h"
+#include "src/matrix_config.h"
+#include <Arduino.h>
+#include <Fonts/TomThumb.h>
+#include <string.h>
+
+// packed glyph rows (bit n = column n) and advances for each font
+static const uint8_t glyphCount = TEXT_LAST_CHAR - TEXT_FIRST_CHAR + 1;
+static uint8_t glyphRows[2][glyphCount][TEXT_GLYPH_ROWS];
+static uint8_t glyphAdvance[2][glyphCount];
+static bool    atlasReady = false;
+
+static TextLabel labelCache[TEXT_LABEL_CACHE];
+static uint8_t   labelCount = 0;
+
+// initTextAtlas: draw every glyph at the canvas origin through GFX and read the pixels back,
+// so the atlas matches print() exactly for both fonts
+void initTextAtlas() {
+  for (uint8_t f = 0; f < 2; f++) {
+    if (f == FONT_TOMTHUMB) matrix.setFont(&TomThumb);
+    else matrix.setFont();
+    for (uint8_t g = 0; g < glyphCount; g++) {
+      char c = (char)(TEXT_FIRST_CHAR + g);
+      matrix.fillRect(0, 0, 8, TEXT_GLYPH_ROWS, 0);
+      int16_t cy = (f == FONT_TOMTHUMB) ? TEXT_TT_BASELINE : 0;
+      matrix.drawChar(0, cy, c, 0xFFFF, 0xFFFF, 1);
+      for (uint8_t r = 0; r < TEXT_GLYPH_ROWS; r++) {
+        uint8_t bits = 0;
+        for (uint8_t x = 0; x < 8; x++) {
+          if (matrix.getPixel(x, r)) bits |= (uint8_t)(1u << x);
+        }
+        glyphRows[f][g][r] = bits;
+      }
+      if (f == FONT_TOMTHUMB) {
+        const GFXglyph *gl = &TomThumb.glyph[c - TomThumb.first];
+        glyphAdvance[f][g] = gl->xAdvance;
+      } else {
+        glyphAdvance[f][g] = CHAR_W;
+      }
+    }
+  }
+  matrix.setFont();
+  matrix.fillRect(0, 0, 8, TEXT_GLYPH_ROWS, 0);
+  atlasReady = true;
+}
+
+static inline uint8_t glyphIndex(char c) {
+  return ((uint8_t)c < TEXT_FIRST_CHAR || (uint8_t)c > TEXT_LAST_CHAR)
+           ? 0 : (uint8_t)c - TEXT_FIRST_CHAR;
+}
+
+int16_t textWidth(const char *s, TextFont font) {
+  int16_t w = 0;
+  for (; *s; s++) w += glyphAdvance[font][glyphIndex(*s)];
+  return w;
+}
+
+// blitRows: emit every horizontal run of a 32-column row word as one fill; columns left of the
+// screen are masked off up front and the row loop skips rows outside the screen
+static void blitRows(const uint32_t *rows, int16_t x, int16_t y, uint8_t size, uint16_t color) {
+  const int16_t sw = matrix.width(), sh = matrix.height();
+  if (x >= sw || x + 32 * size <= 0) return;
+  uint32_t clipMask = 0xFFFFFFFFu;
+  if (x < 0) {
+    int16_t hidden = -x / size;
+    clipMask = (hidden >= 32) ? 0 : (clipMask << hidden);
+  }
+  int16_t visible = (sw - x + size - 1) / size;
+  if (visible < 32) clipMask &= (1u << visible) - 1;
+
+  for (uint8_t r = 0; r < TEXT_GLYPH_ROWS; r++) {
+    int16_t yy = y + r * size;
+    if (yy >= sh) break;
+    if (yy + size <= 0) continue;
+    uint32_t m = rows[r] & clipMask;
+    while (m) {
+      uint8_t start = __builtin_ctz(m);
+      uint32_t shifted = m >> start;
+      uint8_t len = (shifted == 0xFFFFFFFFu) ? 32 - start : __builtin_ctz(~shifted);
+      if (size == 1) matrix.drawFastHLine(x + start, yy, len, color);
+      else matrix.fillRect(x + start * size, yy, len * size, size, color);
+      m &= ~(((len >= 32) ? 0xFFFFFFFFu : ((1u << len) - 1)) << start);
+    }
+  }
+}
+
+// packRun: OR glyphs into 32-column row words until the next glyph would not fit; returns chars consumed
+static uint8_t packRun(const char *s, TextFont font, uint32_t *rows, uint8_t &w) {
+  memset(rows, 0, sizeof(uint32_t) * TEXT_GLYPH_ROWS);
+  uint8_t n = 0;
+  w = 0;
+  while (s[n]) {
+    uint8_t g = glyphIndex(s[n]);
+    uint8_t adv = glyphAdvance[font][g];
+    if (w + adv > 32 && n > 0) break;
+    const uint8_t *gr = glyphRows[font][g];
+    for (uint8_t r = 0; r < TEXT_GLYPH_ROWS; r++) rows[r] |= (uint32_t)gr[r] << w;
+    w += adv;
+    n++;
+  }
+  return n;
+}
+
+void textDraw(int16_t x, int16_t y, const char *s, uint16_t color, uint8_t size, TextFont font) {
+  if (!atlasReady || !s) return;
+  if (font == FONT_TOMTHUMB) y -= TEXT_TT_BASELINE * size;
+  uint32_t rows[TEXT_GLYPH_ROWS];
+  while (*s) {
+    uint8_t w;
+    uint8_t n = packRun(s, font, rows, w);
+    blitRows(rows, x, y, size, color);
+    x += w * size;
+    s += n;
+    if (x >= matrix.width()) break;
+  }
+}
+
+void textDrawChar(int16_t x, int16_t y, char c, uint16_t color, uint8_t size, TextFont font) {
+  char s[2] = { c, '\0' };
+  textDraw(x, y, s, color, size, font);
+}
+
+void textRasterize(TextLabel &l, const char *s, TextFont font) {
+  l.src = s;
+  l.font = font;
+  packRun(s, font, l.rows, l.w);
+}
+
+void textBlit(const TextLabel &l, int16_t x, int16_t y, uint16_t color, uint8_t size) {
+  if (l.font == FONT_TOMTHUMB) y -= TEXT_TT_BASELINE * size;
+  blitRows(l.rows, x, y, size, color);
+}
+
+// textDrawLabel: cache hits compare the literal's pointer first, then its text; strings wider
+// than one label word or a full cache fall back to textDraw()
+void textDrawLabel(int16_t x, int16_t y, const char *s, uint16_t color, uint8_t size, TextFont font) {
+  if (!atlasReady || !s) return;
+  for (uint8_t i = 0; i < labelCount; i++) {
+    const TextLabel &l = labelCache[i];
+    if (l.font == font && (l.src == s || strcmp(l.src, s) == 0)) {
+      textBlit(l, x, y, color, size);
+      return;
+    }
+  }
+  if (labelCount < TEXT_LABEL_CACHE && textWidth(s, font) <= 32) {
+    TextLabel &l = labelCache[labelCount++];
+    textRasterize(l, s, font);
+    textBlit(l, x, y, color, size);
+    return;
+  }
+  textDraw(x, y, s, color, size, font);
+}
+
+// benchText: the label strings every mode draws, through GFX print, the atlas, and the label cache
+void benchText() {
+  static const char *const words[] = {
+    "MATCH", "SETUP", "FETCH", "PIECE", "AI", "ON", "LEVEL", "READY", "AUTO", "LOCK"
+  };
+  const uint8_t wordCount = sizeof(words) / sizeof(words[0]);
+  const uint16_t reps = 200;
+  uint32_t glyphs = 0;
+  for (uint8_t i = 0; i < wordCount; i++) glyphs += strlen(words[i]);
+  glyphs *= reps;
+  uint16_t white = matrix.color565(255, 255, 255);
+
+  // drawn over the live frame, which is handed back as it was
+  matrix.saveCanvas();
+  for (uint8_t size = 1; size <= 2; size++) {
+    unsigned long t0 = micros();
+    matrix.setTextColor(white);
+    matrix.setTextSize(size);
+    for (uint16_t n = 0; n < reps; n++) {
+      for (uint8_t i = 0; i < wordCount; i++) {
+        matrix.setCursor(0, (i * 9) % 120);
+        matrix.print(words[i]);
+      }
+    }
+    matrix.setTextSize(1);
+    unsigned long gfxUs = micros() - t0;
+
+    t0 = micros();
+    for (uint16_t n = 0; n < reps; n++) {
+      for (uint8_t i = 0; i < wordCount; i++) {
+        textDraw(0, (i * 9) % 120, words[i], white, size);
+      }
+    }
+    unsigned long atlasUs = micros() - t0;
+
+    t0 = micros();
+    for (uint16_t n = 0; n < reps; n++) {
+      for (uint8_t i = 0; i < wordCount; i++) {
+        textDrawLabel(0, (i * 9) % 120, words[i], white, size);
+      }
+    }
+    unsigned long labelUs = micros() - t0;
+
+    Serial.print("text size ");
+    Serial.print(size);
+    Serial.print(" (");
+    Serial.print(glyphs);
+    Serial.println(" glyphs):");
+    Serial.print("  gfx print: ");
+    Serial.print(gfxUs ? glyphs * 1000.0f / gfxUs : 0.0f, 1);
+    Serial.println(" glyphs/ms");
+    Serial.print("  atlas:     ");
+    Serial.print(atlasUs ? glyphs * 1000.0f / atlasUs : 0.0f, 1);
+    Serial.println(" glyphs/ms");
+    Serial.print("  label:     ");
+    Serial.print(labelUs ? glyphs * 1000.0f / labelUs : 0.0f, 1);
+    Serial.println(" glyphs/ms");
+  }
+  matrix.restoreCanvas();
+}
@@ -0,0 +1,179 @@
+// © 2025 SC5K Systems
+
+#include "src/transition.h"
+#include "src/matrix_config.h"
+#include "src/clock.h"
+#include <Arduino.h>
+#include <string.h>
+#include <stdio.h>
+
+#define FRAME_PIXELS (WIDTH * HEIGHT)
+
+static const char *const kindNames[FX_KINDS] = { "cut", "fade", "wipe", "dissolve" };
+
+static TransitionKind kind = TRANSITION_DEFAULT;
+static unsigned long  lengthMs = TRANSITION_MS;
+static bool           active = false;
+static unsigned long  startMs = 0;
+
+#if TRANSITIONS_ENABLED
+static uint16_t outgoing[FRAME_PIXELS];
+#endif
+
+// ---- blends ----
+// rgb565 pixels two to a word. halving each channel of x ^ y after clearing the channel
+// low bits (mask 0xF7DE per pixel) keeps one channel from borrowing into the next, so
+// (x & y) + ((x ^ y) & mask) / 2 is the per-channel floor average of both pixel pairs
+static inline uint32_t average2(uint32_t x, uint32_t y) {
+  return (x & y) + (((x ^ y) & 0xF7DEF7DEUL) >> 1);
+}
+
+// level/16 is built from its binary digits, lowest first: each digit averages the running
+// mix with the new pixel (1) or the old one (0), halving the weight of what came before
+void blendFade(uint16_t *dst, const uint16_t *from, uint16_t n, uint8_t level) {
+  if (level >= 16) return;
+  if (level == 0) {
+    memcpy(dst, from, n * sizeof(uint16_t));
+    return;
+  }
+  uint32_t *d = (uint32_t *)dst;
+  const uint32_t *f = (const uint32_t *)from;
+  for (uint16_t i = 0; i < n / 2; i++) {
+    uint32_t a = f[i], b = d[i], x = a;
+    for (uint8_t bit = 1; bit < 16; bit <<= 1) x = average2(x, (level & bit) ? b : a);
+    d[i] = x;
+  }
+}
+
+// blendFadeScalar: the same mix one pixel at a time through unpacked channels (benchmark only)
+static void blendFadeScalar(uint16_t *dst, const uint16_t *from, uint16_t n, uint8_t level) {
+  for (uint16_t i = 0; i < n; i++) {
+    uint16_t a = from[i], b = dst[i];
+    int r = (a >> 11) + ((((b >> 11) - (a >> 11)) * level) >> 4);
+    int g = ((a >> 5) & 0x3F) + (((((b >> 5) & 0x3F) - ((a >> 5) & 0x3F)) * level) >> 4);
+    int bl = (a & 0x1F) + ((((b & 0x1F) - (a & 0x1F)) * level) >> 4);
+    dst[i] = (r << 11) | (g << 5) | bl;
+  }
+}
+
+// wipe: columns left of 'edge' are the new frame, the rest stays the outgoing one
+static void blendWipe(uint16_t *dst, const uint16_t *from, uint16_t edge) {
+  for (uint16_t y = 0; y < HEIGHT; y++) {
+    memcpy(dst + y * WIDTH + edge, from + y * WIDTH + edge, (WIDTH - edge) * sizeof(uint16_t));
+  }
+}
+
+// dissolve: pixel i has switched once its key is below 'shown' (out of FRAME_PIXELS).
+// an odd multiplier permutes 0..4095, so each step switches an exact count of pixels
+static void blendDissolve(uint16_t *dst, const uint16_t *from, uint16_t shown) {
+  for (uint16_t i = 0; i < FRAME_PIXELS; i++) {
+    if ((uint16_t)((i * 2897u) & (FRAME_PIXELS - 1)) >= shown) dst[i] = from[i];
+  }
+}
+
+static_assert((FRAME_PIXELS & (FRAME_PIXELS - 1)) == 0, "dissolve keys need a power of two frame");
+
+// ---- transitions ----
+// stepIn: progress q (1/4096ths) as a count out of 'full' that starts one sixteenth in, so
+// the first show after a switch (t == 0) already has some of the incoming frame
+static inline uint16_t stepIn(uint16_t q, uint32_t full) {
+  return (uint16_t)(full / 16 + ((uint32_t)q * (full - full / 16) >> 12));
+}
+
+void transitionStart() {
+#if TRANSITIONS_ENABLED
+  if (kind == FX_CUT || !lengthMs) return;
+  // the panel buffer has already been scaled by the current limit (power.h), and the blended
+  // frames are scaled again, so rebuild the outgoing image from the canvas instead, mixing in
+  // a transition that is still running
+  uint16_t *frame = panel.getBuffer();
+  if (!frame) return;
+  matrix.present();
+  transitionApply(frame);
+  memcpy(outgoing, frame, sizeof(outgoing));
+  startMs = clockMillis();
+  active = true;
+#endif
+}
+
+void transitionApply(uint16_t *frame) {
+#if TRANSITIONS_ENABLED
+  if (!active || !frame) return;
+  unsigned long t = clockMillis() - startMs;
+  if (t >= lengthMs) {
+    active = false;
+    return;
+  }
+  // progress in 1/4096ths
+  uint16_t q = (uint16_t)((t << 12) / lengthMs);
+  switch (kind) {
+    case FX_FADE:     blendFade(frame, outgoing, FRAME_PIXELS, stepIn(q, 16)); break;
+    case FX_WIPE:     blendWipe(frame, outgoing, stepIn(q, WIDTH)); break;
+    case FX_DISSOLVE: blendDissolve(frame, outgoing, stepIn(q, FRAME_PIXELS)); break;
+    default: break;
+  }
+#else
+  (void)frame;
+#endif
+}
+
+bool transitionSet(const char *name, unsigned long ms) {
+  for (uint8_t i = 0; i < FX_KINDS; i++) {
+    if (strcmp(name, kindNames[i]) == 0) {
+      kind = (TransitionKind)i;
+      if (ms) lengthMs = ms;
+      active = false;
+      return true;
+    }
+  }
+  return false;
+}
+
+void transitionReport() {
+  char line[48];
+#if TRANSITIONS_ENABLED
+  snprintf(line, sizeof(line), "fx: %s, %lu ms", kindNames[kind], lengthMs);
+#else
+  snprintf(line, sizeof(line), "fx: compiled out (TRANSITIONS_ENABLED 0)");
+#endif
+  Serial.println(line);
+}
+
+// ---- benchmark ----
+// benchRun: time 'frames' passes of one effect over the canvas-sized buffers
+static void benchRun(const char *label, uint8_t which, uint16_t *dst, const uint16_t *from) {
+  const uint8_t frames = 16;
+  unsigned long t0 = micros();
+  for (uint8_t f = 0; f < frames; f++) {
+    switch (which) {
+      case 0: blendFadeScalar(dst, from, FRAME_PIXELS, 1 + f % 15); break;
+      case 1: blendFade(dst, from, FRAME_PIXELS, 1 + f % 15); break;
+      case 2: blendWipe(dst, from, (f * WIDTH) / frames); break;
+      default: blendDissolve(dst, from, (f * FRAME_PIXELS) / frames); break;
+    }
+  }
+  unsigned long us = micros() - t0;
+  Serial.print(label);
+  Serial.print((float)FRAME_PIXELS * frames / (us ? us : 1), 1);
+  Serial.print(" px/us, ");
+  Serial.print((float)us / frames, 1);
+  Serial.println(" us/frame");
+}
+
+void benchBlend() {
+#if TRANSITIONS_ENABLED
+  // the outgoing buffer and the panel's own buffer stand in for the two frames; a running
+  // transition is dropped, and present() puts the panel buffer back before anything shows
+  active = false;
+  uint16_t *dst = panel.getBuffer();
+  if (!dst) return;
+  for (uint16_t i = 0; i < FRAME_PIXELS; i++) outgoing[i] = (uint16_t)(i * 40503u);
+  Serial.println("blend, full 128x32 frame:");
+  benchRun("  fade scalar: ", 0, dst, outgoing);
+  benchRun("  fade swar:   ", 1, dst, outgoing);
+  benchRun("  wipe:        ", 2, dst, outgoing);
+  benchRun("  dissolve:    ", 3, dst, outgoing);
+  matrix.present();
+#endif
+  transitionReport();
+}
@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+# © 2025 SC5K Systems
+"""
+anim_encode.py: encode an animated GIF into a perryMatrix animation container.
+
+Container layout (little-endian, see src/anim.h):
+  header   'P' 'M' 'A' '1', w:u8, h:u8, frames:u16, paletteSize:u16, flags:u8, 0:u8
+  palette  paletteSize x u16 rgb565
+  frame    type:u8 (0=key, 1=delta), durationMs:u16, payloadLen:u16, payload
+Payload ops walk the frame in row-major order:
+  00nnnnnn  skip n+1 unchanged pixels        (delta frames only)
+  01nnnnnn  skip (n+1)*64 unchanged pixels   (delta frames only)
+  10nnnnnn  n+1 pixels of the following palette index
+  11nnnnnn  n+1 literal palette indices follow
+Frame 0 is always a keyframe so the animation can loop.
+
+Usage:
+  python3 tools/anim_encode.py tools/anims/climb_burst.gif --name animClimbBurst \\
+      --cpp perryMatrix/anim_assets.cpp --header perryMatrix/src/anim_assets.h
+
+Several GIFs may be given; --name then applies to the first and the rest are
+named from their file stems.  Only the standard library is required.
+"""
+import argparse
+import os
+import struct
+import sys
+
+FLAG_LOOP = 0x01
+
+
+def lzw_decode(data, min_size, count):
+    clear, eoi = 1 << min_size, (1 << min_size) + 1
+    size = min_size + 1
+    table = [bytes([i]) for i in range(clear)] + [b"", b""]
+    out = bytearray()
+    prev = None
+    bitpos = 0
+    nbits = len(data) * 8
+    while bitpos + size <= nbits and len(out) < count:
+        code = 0
+        for i in range(size):
+            byte = data[(bitpos + i) >> 3]
+            code |= ((byte >> ((bitpos + i) & 7)) & 1) << i
+        bitpos += size
+        if code == clear:
+            size = min_size + 1
+            table = table[:clear + 2]
+            prev = None
+            continue
+        if code == eoi:
+            break
+        if code < len(table):
+            entry = table[code]
+            if prev is not None:
+                table.append(prev + entry[:1])
+        elif prev is not None:
+            entry = prev + prev[:1]
+            table.append(entry)
+        else:
+            raise ValueError("corrupt LZW stream")
+        out += entry
+        prev = entry
+        if len(table) == (1 << size) and size < 12:
+            size += 1
+    return bytes(out[:count])
+
+
+def read_gif(path):
+    """Return (w, h, [(rgb_pixels, delay_ms), ...]) with frames fully composed."""
+    with open(path, "rb") as f:
+        d = f.read()
+    if d[:3] != b"GIF":
+        raise ValueError("%s: not a GIF" % path)
+    w, h, flags, bg, _ = struct.unpack("<HHBBB", d[6:13])
+    pos = 13
+    gct = []
+    if flags & 0x80:
+        n = 2 << (flags & 7)
+        gct = [tuple(d[pos + i * 3:pos + i * 3 + 3]) for i in range(n)]
+        pos += n * 3
+    bg_col = gct[bg] if bg < len(gct) else (0, 0, 0)
+    canvas = [bg_col] * (w * h)
+    frames = []
+    delay, transp, disposal = 100, None, 0
+    while pos < len(d):
+        tag = d[pos]
+        pos += 1
+        if tag == 0x3B:
+            break
+        if tag == 0x21:
+            label = d[pos]
+            pos += 1
+            blocks = b""
+            while d[pos]:
+                blocks += d[pos + 1:pos + 1 + d[pos]]
+                pos += 1 + d[pos]
+            pos += 1
+            if label == 0xF9 and len(blocks) >= 4:
+                packed, dl, ti = struct.unpack("<BHB", blocks[:4])
+                disposal = (packed >> 2) & 7
+                transp = ti if packed & 1 else None
+                delay = dl * 10 if dl else 100
+            continue
+        if tag != 0x2C:
+            raise ValueError("%s: unexpected block 0x%02X" % (path, tag))
+        ix, iy, iw, ih, iflags = struct.unpack("<HHHHB", d[pos:pos + 9])
+        pos += 9
+        ct = gct
+        if iflags & 0x80:
+            n = 2 << (iflags & 7)
+            ct = [tuple(d[pos + i * 3:pos + i * 3 + 3]) for i in range(n)]
+            pos += n * 3
+        min_size = d[pos]
+        pos += 1
+        lzw = b""
+        while d[pos]:
+            lzw += d[pos + 1:pos + 1 + d[pos]]
+            pos += 1 + d[pos]
+        pos += 1
+        idx = lzw_decode(lzw, min_size, iw * ih)
+        rows = list(range(ih))
+        if iflags & 0x40:
+            rows = (list(range(0, ih, 8)) + list(range(4, ih, 8)) +
+                    list(range(2, ih, 4)) + list(range(1, ih, 2)))
+        before = list(canvas)
+        for n, row in enumerate(rows):
+            for x in range(iw):
+                i = n * iw + x
+                if i >= len(idx) or idx[i] == transp:
+                    continue
+                px, py = ix + x, iy + row
+                if px < w and py < h:
+                    canvas[py * w + px] = ct[idx[i]]
+        frames.append((list(canvas), delay))
+        if disposal == 2:
+            for row in range(ih):
+                for x in range(iw):
+                    if ix + x < w and iy + row < h:
+                        canvas[(iy + row) * w + ix + x] = bg_col
+        elif disposal == 3:
+            canvas = before
+        delay, transp, disposal = 100, None, 0
+    return w, h, frames
+
+
+def rgb565(c):
+    r, g, b = c
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def encode_ops(cur, prev):
+    """Encode one frame; prev=None means keyframe (no skips)."""
+    out = bytearray()
+    n, i = len(cur), 0
+    while i < n:
+        if prev is not None and cur[i] == prev[i]:
+            j = i
+            while j < n and cur[j] == prev[j]:
+                j += 1
+            if j == n:
+                break
+            skip = j - i
+            while skip >= 64:
+                k = min(skip // 64, 64)
+                out.append(0x40 | (k - 1))
+                skip -= k * 64
+            if skip:
+                out.append(skip - 1)
+            i = j
+            continue
+        j = i
+        while j < n and j - i < 64 and cur[j] == cur[i] and (prev is None or cur[j] != prev[j]):
+            j += 1
+        if j - i >= 3:
+            out += bytes([0x80 | (j - i - 1), cur[i]])
+            i = j
+            continue
+        j = i
+        while (j < n and j - i < 64 and (prev is None or cur[j] != prev[j]) and
+               not (j + 2 < n and cur[j] == cur[j + 1] == cur[j + 2])):
+            j += 1
+        if j == i:
+            j = i + 1
+        out.append(0xC0 | (j - i - 1))
+        out += bytes(cur[i:j])
+        i = j
+    return out
+
+
+def encode(path, key_interval, loop):
+    w, h, frames = read_gif(path)
+    if w > 255 or h > 255:
+        raise ValueError("%s: animations are limited to 255x255" % path)
+    colours = sorted({rgb565(c) for f, _ in frames for c in f})
+    if len(colours) > 256:
+        raise ValueError("%s: more than 256 rgb565 colours" % path)
+    lut = {c: i for i, c in enumerate(colours)}
+    blob = bytearray(b"PMA1")
+    blob += struct.pack("<BBHHBB", w, h, len(frames), len(colours),
+                        FLAG_LOOP if loop else 0, 0)
+    for c in colours:
+        blob += struct.pack("<H", c)
+    prev, since_key, stats = None, 0, [0, 0]
+    for fi, (pixels, delay) in enumerate(frames):
+        cur = [lut[rgb565(c)] for c in pixels]
+        key = encode_ops(cur, None)
+        ftype, payload = 0, key
+        if fi and since_key < key_interval:
+            delta = encode_ops(cur, prev)
+            if len(delta) < len(key):
+                ftype, payload = 1, delta
+        if len(payload) > 0xFFFF:
+            raise ValueError("%s: frame %d too large" % (path, fi))
+        since_key = since_key + 1 if ftype else 0
+        stats[ftype] += 1
+        blob += struct.pack("<BHH", ftype, min(delay, 0xFFFF), len(payload))
+        blob += payload
+        prev = cur
+    return w, h, len(frames), len(colours), stats, blob
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("gifs", nargs="+")
+    ap.add_argument("--name", help="C symbol for the first animation")
+    ap.add_argument("--cpp", required=True)
+    ap.add_argument("--header", required=True)
+    ap.add_argument("--key-interval", type=int, default=32,
+                    help="force a keyframe at least every N frames")
+    ap.add_argument("--once", action="store_true", help="do not loop")
+    args = ap.parse_args()
+
+    hdr = ["// © 2025 SC5K Systems",
+           "// generated by tools/anim_encode.py -- do not edit by hand",
+           "", "#pragma once", "#include <stdint.h>", ""]
+    cpp = ["// © 2025 SC5K Systems",
+           "// generated by tools/anim_encode.py -- do not edit by hand",
+           "", '#include "src/anim_assets.h"', ""]
+    for n, path in enumerate(args.gifs):
+        stem = os.path.splitext(os.path.basename(path))[0]
+        name = args.name if (n == 0 and args.name) else \
+            "anim" + "".join(p.capitalize() for p in stem.split("_"))
+        w, h, nf, nc, stats, blob = encode(path, args.key_interval, not args.once)
+        hdr.append("// %s: %dx%d, %d frames (%d key, %d delta), %d colours, %d bytes" % (
+            os.path.basename(path), w, h, nf, stats[0], stats[1], nc, len(blob)))
+        hdr.append("extern const uint8_t %s[];" % name)
+        hdr.append("extern const uint32_t %sSize;" % name)
+        cpp.append("const uint8_t %s[] = {" % name)
+        for i in range(0, len(blob), 12):
+            cpp.append("  " + ", ".join("0x%02X" % b for b in blob[i:i + 12]) + ",")
+        cpp.append("};")
+        cpp.append("const uint32_t %sSize = sizeof(%s);" % (name, name))
+        cpp.append("")
+        print("%-22s %dx%d %3d frames %5d bytes (raw %d)" % (
+            os.path.basename(path), w, h, nf, len(blob), w * h * 2 * nf), file=sys.stderr)
+    with open(args.header, "w", encoding="utf-8") as f:
+        f.write("\n".join(hdr) + "\n")
+    with open(args.cpp, "w", encoding="utf-8") as f:
+        f.write("\n".join(cpp))
+
+
+if __name__ == "__main__":
+    main()
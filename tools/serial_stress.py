@@ -0,0 +1,193 @@
+#!/usr/bin/env python3
+# © 2025 SC5K Systems
+"""
+serial_stress.py: flood the RoboRIO link with synthetic traffic and measure what survives.
+
+Lines go out as "#<seq> <mode> <payload>" so the firmware answers each one that reaches
+the panel with "@<seq> <total> <byte-line> <line-parse> <parse-apply> <apply-show>" (us,
+see src/latency.h).  A sequence number that never comes back was dropped, merged away by
+the drip feed, or one of more than 8 traced lines waiting for the same frame (?lat counts
+those on USB).  At the end "?rx" is sent; the firmware answers it on Serial1, and its reader
+counters (truncated lines, bytes cut, merged, malformed) are printed.
+
+Traffic mix (weights via --mix):
+  checklist  random flips of the four checklist flags       "0 1,0,1,1"
+  dynamic    request/intake storms with score/climb pulses  "2 1,1,0,0"
+  malformed  lines with no usable mode                      "x,,3", ",,,", "#"
+  long       valid lines padded past the 32/64-byte buffers "2 1,0,0,0,0,0,..."
+
+Target: a USB-serial adapter wired to the Matrix Portal's RX/TX instead of the RoboRIO, at
+the 9600 baud Serial1 runs at.  Writes block, so an --bps above what the link carries is
+throttled to it; the rate printed is what was actually written.
+  python3 tools/serial_stress.py /dev/ttyUSB0 --bps 960
+
+Only the standard library is required (POSIX).
+"""
+import argparse
+import fcntl
+import os
+import random
+import select
+import termios
+import time
+import tty
+
+
+def open_port(path):
+    # non-blocking only so the open doesn't wait on carrier; reads go through select() and
+    # writes are meant to block
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY | os.O_NONBLOCK)
+    tty.setraw(fd)
+    attrs = termios.tcgetattr(fd)
+    attrs[2] |= termios.CLOCAL
+    attrs[4] = attrs[5] = termios.B9600   # Serial1.begin(9600) in the firmware
+    termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    fcntl.fcntl(fd, fcntl.F_SETFL, fcntl.fcntl(fd, fcntl.F_GETFL) & ~os.O_NONBLOCK)
+    return fd
+
+
+def write_all(fd, data):
+    """Write every byte, waiting out a full output queue; returns the bytes written."""
+    done = 0
+    while done < len(data):
+        try:
+            done += os.write(fd, data[done:])
+        except BlockingIOError:
+            select.select([], [fd], [])
+    return done
+
+
+class Traffic:
+    def __init__(self, seed, weights):
+        self.rng = random.Random(seed)
+        self.weights = weights
+        self.checklist = [1, 1, 1, 1]
+        self.dyn = [0, 0, 0, 0]
+
+    def line(self):
+        kind = self.rng.choices(list(self.weights), list(self.weights.values()))[0]
+        r = self.rng
+        if kind == "checklist":
+            i = r.randrange(4)
+            self.checklist[i] ^= 1
+            body = "0 " + ",".join(map(str, self.checklist))
+        elif kind == "dynamic":
+            self.dyn[r.randrange(2)] ^= 1
+            self.dyn[2] = r.choice([0, 0, 0, 0, 1, 2, 3, 4])
+            self.dyn[3] = r.choice([0, 0, 0, 1, 2, 3])
+            body = "2 " + ",".join(map(str, self.dyn))
+        elif kind == "malformed":
+            body = r.choice(["x,,3", ",,,", "#", "two 1,0", "- 1", "\t"])
+        else:
+            base = "2 " + ",".join(map(str, self.dyn))
+            body = base + ",0" * r.randrange(20, 60)
+        return kind, body
+
+
+def pct(values, p):
+    if not values:
+        return 0
+    s = sorted(values)
+    return s[min(len(s) - 1, int(len(s) * p / 100))]
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("port", help="serial device wired to Serial1")
+    ap.add_argument("--bps", type=float, default=960, help="offered load in bytes/s (960 = 9600 baud)")
+    ap.add_argument("--seconds", type=float, default=10)
+    ap.add_argument("--settle", type=float, default=2, help="wait for late echoes before ?rx")
+    ap.add_argument("--mix", default="checklist=3,dynamic=5,malformed=1,long=1")
+    ap.add_argument("--seed", type=int, default=1)
+    args = ap.parse_args()
+
+    weights = {k: float(v) for k, v in (kv.split("=") for kv in args.mix.split(","))}
+    fd = open_port(args.port)
+
+    traffic = Traffic(args.seed, weights)
+    sent = {}            # seq -> (kind, send time)
+    kinds = {}
+    echoes = {}          # seq -> (firmware total us, host rtt ms)
+    other = []
+    rx = b""
+    out_bytes = 0
+    seq = 0
+
+    def poll(timeout):
+        nonlocal rx
+        r, _, _ = select.select([fd], [], [], timeout)
+        if not r:
+            return
+        try:
+            rx += os.read(fd, 4096)
+        except (BlockingIOError, OSError):
+            return
+        *lines, rx = rx.split(b"\n")
+        now = time.monotonic()
+        for raw in lines:
+            text = raw.decode("ascii", "replace").strip()
+            parts = text.split()
+            if len(parts) == 6 and parts[0].startswith("@") and parts[0][1:].isdigit():
+                s = int(parts[0][1:])
+                if s in sent and s not in echoes:
+                    echoes[s] = (int(parts[1]), (now - sent[s][1]) * 1000)
+            elif text:
+                other.append(text)
+
+    # counters start with the flood
+    write_all(fd, b"?rx reset\n")
+    poll(0.2)
+
+    start = time.monotonic()
+    due = start
+    while time.monotonic() - start < args.seconds:
+        now = time.monotonic()
+        if now >= due:
+            seq += 1
+            kind, body = traffic.line()
+            data = f"#{seq} {body}\n".encode()
+            out_bytes += write_all(fd, data)
+            sent[seq] = (kind, time.monotonic())
+            kinds[kind] = kinds.get(kind, 0) + 1
+            due += len(data) / args.bps
+        poll(max(0, min(due - time.monotonic(), 0.01)))
+    elapsed = time.monotonic() - start
+
+    end = time.monotonic() + args.settle
+    while time.monotonic() < end:
+        poll(0.05)
+    other.clear()
+    write_all(fd, b"?rx\n")
+    end = time.monotonic() + 1.5
+    while time.monotonic() < end:
+        poll(0.05)
+
+    traceable = [s for s, (k, _) in sent.items() if k != "malformed"]
+    got = [s for s in traceable if s in echoes]
+    fw = [echoes[s][0] for s in got]
+    rtt = [echoes[s][1] for s in got]
+    print(f"sent {seq} lines, {out_bytes} B in {elapsed:.1f} s: {out_bytes / elapsed:.0f} B/s "
+          f"({out_bytes * 10 / elapsed / 9600:.2f}x 9600 baud)")
+    print("  " + ", ".join(f"{k} {v}" for k, v in sorted(kinds.items())))
+    lost = len(traceable) - len(got)
+    print(f"reached the panel: {len(got)}/{len(traceable)} valid lines "
+          f"({100 * lost / max(1, len(traceable)):.1f}% dropped, merged or past the trace ring)")
+    for k in weights:
+        if k == "malformed":
+            continue
+        ks = [s for s in traceable if sent[s][0] == k]
+        if ks:
+            print(f"  {k}: {sum(s in echoes for s in ks)}/{len(ks)}")
+    print(f"message->frame (firmware, us): p50 {pct(fw, 50)}  p99 {pct(fw, 99)}  max {max(fw, default=0)}")
+    print(f"send->echo (host, ms):         p50 {pct(rtt, 50):.1f}  p99 {pct(rtt, 99):.1f}")
+    if other:
+        print("firmware ?rx:")
+        for line in other:
+            if "?rx" not in line:
+                print("  " + line)
+    else:
+        print("(no ?rx reply)")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+# © 2025 SC5K Systems
+"""
+sprite_conv.py: convert PNG sprites into RLE-compressed C arrays for perryMatrix.
+
+Each PNG becomes one RleSprite.  Sprites with 256 or fewer opaque colours are
+stored indexed (1 byte per run + a shared RGB565 palette); anything else is
+stored as raw RGB565 runs.  Pixels with alpha < 128 are transparent.
+
+Row format (see src/sprite.h):
+  header byte  bit7=1 -> opaque run of (hdr & 0x7F) + 1 pixels, colour follows
+               bit7=0 -> transparent skip of hdr + 1 pixels
+  colour       1 byte palette index (indexed) or 2 bytes RGB565 little-endian
+
+Usage:
+  python3 tools/sprite_conv.py tools/sprites/*.png \\
+      --cpp perryMatrix/sprite_assets.cpp --header perryMatrix/src/sprite_assets.h
+
+Only the standard library is required.
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+PNG_SIG = b"\x89PNG\r\n\x1a\n"
+
+
+def read_png(path):
+    """Decode a non-interlaced 8-bit PNG into (w, h, [(r,g,b,a), ...])."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != PNG_SIG:
+        raise ValueError("%s: not a PNG" % path)
+    pos = 8
+    idat = b""
+    palette, trns = [], b""
+    w = h = depth = ctype = interlace = None
+    while pos < len(data):
+        (length,) = struct.unpack(">I", data[pos:pos + 4])
+        tag = data[pos + 4:pos + 8]
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if tag == b"IHDR":
+            w, h, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif tag == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif tag == b"tRNS":
+            trns = body
+        elif tag == b"IDAT":
+            idat += body
+        elif tag == b"IEND":
+            break
+    if depth != 8 or interlace:
+        raise ValueError("%s: only 8-bit non-interlaced PNGs are supported" % path)
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+    stride = w * channels
+    raw = zlib.decompress(idat)
+    rows, prev = [], bytearray(stride)
+    for y in range(h):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if (pa <= pb and pa <= pc) else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+    pixels = []
+    for line in rows:
+        for x in range(w):
+            px = line[x * channels:(x + 1) * channels]
+            if ctype == 0:
+                pixels.append((px[0], px[0], px[0], 255))
+            elif ctype == 2:
+                pixels.append((px[0], px[1], px[2], 255))
+            elif ctype == 3:
+                r, g, b = palette[px[0]]
+                a = trns[px[0]] if px[0] < len(trns) else 255
+                pixels.append((r, g, b, a))
+            elif ctype == 4:
+                pixels.append((px[0], px[0], px[0], px[1]))
+            else:
+                pixels.append(tuple(px))
+    return w, h, pixels
+
+
+def rgb565(r, g, b):
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def encode_rows(w, h, colours, indexed):
+    """colours: list of rgb565 or None (transparent); returns (data, offsets)."""
+    data, offsets = bytearray(), []
+    for y in range(h):
+        offsets.append(len(data))
+        row = colours[y * w:(y + 1) * w]
+        x = 0
+        while x < w:
+            c = row[x]
+            n = 1
+            while x + n < w and n < 128 and row[x + n] == c:
+                n += 1
+            if c is None:
+                data.append(n - 1)
+            else:
+                data.append(0x80 | (n - 1))
+                if indexed:
+                    data.append(c)
+                else:
+                    data += struct.pack("<H", c)
+            x += n
+    return data, offsets
+
+
+def c_name(path):
+    stem = os.path.splitext(os.path.basename(path))[0]
+    return "sprite" + "".join(part.capitalize() for part in stem.split("_"))
+
+
+def convert(path, force_rgb):
+    w, h, pixels = read_png(path)
+    if w > 255 or h > 255:
+        raise ValueError("%s: sprites are limited to 255x255" % path)
+    cols = [rgb565(r, g, b) if a >= 128 else None for (r, g, b, a) in pixels]
+    palette = sorted({c for c in cols if c is not None})
+    indexed = not force_rgb and len(palette) <= 256
+    if indexed:
+        lut = {c: i for i, c in enumerate(palette)}
+        cols = [lut[c] if c is not None else None for c in cols]
+    data, offsets = encode_rows(w, h, cols, indexed)
+    return {
+        "name": c_name(path), "src": os.path.basename(path), "w": w, "h": h,
+        "indexed": indexed, "palette": palette if indexed else [],
+        "data": data, "offsets": offsets, "raw": w * h * 2,
+    }
+
+
+def hex_block(values, fmt, per_line):
+    out = []
+    for i in range(0, len(values), per_line):
+        out.append("  " + ", ".join(fmt % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(out)
+
+
+def emit(sprites, cpp_path, header_path):
+    hdr = ["// © 2025 SC5K Systems",
+           "// generated by tools/sprite_conv.py -- do not edit by hand",
+           "",
+           "#pragma once",
+           '#include "sprite.h"',
+           ""]
+    for s in sprites:
+        hdr.append("// %s: %dx%d %s, %d bytes rle (%d raw)" % (
+            s["src"], s["w"], s["h"], "indexed" if s["indexed"] else "rgb565",
+            len(s["data"]), s["raw"]))
+        hdr.append("extern const RleSprite %s;" % s["name"])
+    cpp = ["// © 2025 SC5K Systems",
+           "// generated by tools/sprite_conv.py -- do not edit by hand",
+           "",
+           '#include "src/sprite_assets.h"',
+           ""]
+    for s in sprites:
+        n = s["name"]
+        if s["indexed"]:
+            cpp.append("static const uint16_t %sPalette[] = {" % n)
+            cpp.append(hex_block(s["palette"], "0x%04X", 8))
+            cpp.append("};")
+        cpp.append("static const uint16_t %sRows[] = {" % n)
+        cpp.append(hex_block(s["offsets"], "%d", 12))
+        cpp.append("};")
+        cpp.append("static const uint8_t %sData[] = {" % n)
+        cpp.append(hex_block(list(s["data"]), "0x%02X", 12))
+        cpp.append("};")
+        cpp.append("const RleSprite %s = {" % n)
+        cpp.append("  %d, %d, %s, %d," % (
+            s["w"], s["h"], "SPRITE_INDEXED" if s["indexed"] else "SPRITE_RGB565",
+            len(s["palette"])))
+        cpp.append("  %s, %sRows, %sData" % (
+            n + "Palette" if s["indexed"] else "nullptr", n, n))
+        cpp.append("};")
+        cpp.append("")
+    with open(header_path, "w", encoding="utf-8") as f:
+        f.write("\n".join(hdr) + "\n")
+    with open(cpp_path, "w", encoding="utf-8") as f:
+        f.write("\n".join(cpp))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    ap.add_argument("pngs", nargs="+")
+    ap.add_argument("--cpp", required=True, help="output .cpp with sprite data")
+    ap.add_argument("--header", required=True, help="output header with externs")
+    ap.add_argument("--rgb565", action="append", default=[],
+                    help="sprite file stem to force into rgb565 format")
+    args = ap.parse_args()
+    sprites = []
+    for path in sorted(args.pngs):
+        stem = os.path.splitext(os.path.basename(path))[0]
+        s = convert(path, stem in args.rgb565)
+        sprites.append(s)
+        print("%-20s %3dx%-3d %-7s %5d bytes (raw %d)" % (
+            s["src"], s["w"], s["h"], "indexed" if s["indexed"] else "rgb565",
+            len(s["data"]) + 2 * len(s["offsets"]) + 2 * len(s["palette"]), s["raw"]),
+            file=sys.stderr)
+    emit(sprites, args.cpp, args.header)
+
+
+if __name__ == "__main__":
+    main()